@@ -4,11 +4,26 @@
 #include <vector>
 
 #include <GameFramework.hpp>
+#include <Input/StaticBinding.hpp>
 
 #include "FPSCamera.hpp"
 
 using namespace GameFramework;
 
+namespace
+{
+LogCategory g_gameLog("Hello3D");
+
+// bindings are parsed at compile time, so a typo in them doesn't compile
+constexpr auto s_quitBinding = ParseStaticBinding("KeyEscape");
+constexpr auto s_moveForwardBinding = ParseStaticBinding("KeyW");
+constexpr auto s_moveBackwardBinding = ParseStaticBinding("KeyS");
+constexpr auto s_moveLeftBinding = ParseStaticBinding("KeyA");
+constexpr auto s_moveRightBinding = ParseStaticBinding("KeyD");
+constexpr auto s_rotateCameraBinding =
+  ParseStaticBinding("MouseCursorX+MouseCursorY;GamepadLeftStickX+GamepadLeftStickY");
+} // namespace
+
 enum ActionCode
 {
   Quit,
@@ -30,6 +45,10 @@ public:
 
   virtual std::string GetGameName() const override { return "Hello3D"; }
   virtual std::vector<InputBinding> GetInputConfiguration() const override;
+  virtual double GetTargetFrameRate() const override { return 60.0; }
+
+  /// cubes are static, so they are created once and live in the render plugin between frames
+  virtual void LoadScene(IRetainedScene3D & scene) override;
 
   ///
   virtual void Tick(double deltaTime) override;
@@ -59,12 +78,12 @@ std::vector<InputBinding> Hello3D::GetInputConfiguration() const
 {
   // clang-format off
   std::vector<InputBinding>
-    actions{{"Quit", ActionCode::Quit, "KeyEscape", ActionType::Event},
-            {"MoveForward", ActionCode::MoveForward, "KeyW", ActionType::Continous},
-            {"MoveBackward", ActionCode::MoveBackward, "KeyS", ActionType::Continous},
-            {"MoveLeft", ActionCode::MoveLeft, "KeyA",  ActionType::Continous},
-            {"MoveRight", ActionCode::MoveRight, "KeyD",  ActionType::Continous},
-            {"RotateCamera", ActionCode::RotateCamera, "MouseCursorX+MouseCursorY;GamepadLeftStickX+GamepadLeftStickY", ActionType::Axis}};
+    actions{{"Quit", ActionCode::Quit, {}, ActionType::Event, s_quitBinding.GetConditions()},
+            {"MoveForward", ActionCode::MoveForward, {}, ActionType::Continous, s_moveForwardBinding.GetConditions()},
+            {"MoveBackward", ActionCode::MoveBackward, {}, ActionType::Continous, s_moveBackwardBinding.GetConditions()},
+            {"MoveLeft", ActionCode::MoveLeft, {}, ActionType::Continous, s_moveLeftBinding.GetConditions()},
+            {"MoveRight", ActionCode::MoveRight, {}, ActionType::Continous, s_moveRightBinding.GetConditions()},
+            {"RotateCamera", ActionCode::RotateCamera, {}, ActionType::Axis, s_rotateCameraBinding.GetConditions()}};
   // clang-format on
   return actions;
 }
@@ -104,12 +123,19 @@ void Hello3D::OnAction(const AxisAction & axis)
   }
 }
 
+void Hello3D::LoadScene(IRetainedScene3D & scene)
+{
+  scene.AddCube(Cube());
+  scene.AddCube(Cube(Vec3f{3, -3.0, 0.0f}));
+}
+
 void Hello3D::Tick(double deltaTime)
 {
   t += static_cast<float>(deltaTime);
   GenerateSignal(GameSignal::InvalidateRenderCache);
-  GameFramework::Log(GameFramework::LogMessageType::Info, "Tick: ", deltaTime * 1000.0,
-                     " FPS: ", 1.0 / deltaTime);
+  // once per second is enough to watch FPS, skipped frames are counted in the message
+  LOG_RATE_LIMITED(g_gameLog, LogMessageType::Info, 1.0, "Tick: ", deltaTime * 1000.0,
+                   " FPS: ", 1.0 / deltaTime);
 }
 
 void Hello3D::Render(GameFramework::IDevice & device)
@@ -124,8 +150,6 @@ void Hello3D::Render(GameFramework::IDevice & device)
     cam.SetPlacement(m_camera.GetPosition(), m_camera.GetFrontVector());
     cam.SetPerspectiveSettings(PerspectiveSettings{45.0f, device.GetAspectRatio(), {0.1f, 100.0f}});
     scene->SetCamera(cam);
-    scene->AddCube(Cube());
-    scene->AddCube(Cube(Vec3f{3, -3.0, 0.0f}));
   }
 }
 
@@ -1,3 +1,4 @@
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -5,6 +6,11 @@
 #include <GameFramework.hpp>
 using namespace GameFramework;
 
+namespace
+{
+LogCategory g_gameLog("SimpleGame");
+} // namespace
+
 enum Windows
 {
   TEST_WINDOW1,
@@ -30,6 +36,7 @@ public:
 
   virtual std::string GetGameName() const override { return "SimpleGame"; }
   virtual std::vector<InputBinding> GetInputConfiguration() const override;
+  virtual double GetTargetFrameRate() const override { return 60.0; }
 
   ///
   virtual void Tick(double deltaTime) override;
@@ -39,6 +46,10 @@ public:
 
   virtual std::vector<ProtoWindow> GetOutputConfiguration() const override;
 
+  /// animation continues after hot-reload
+  virtual std::vector<std::byte> SerializeState() const override;
+  virtual void DeserializeState(std::span<const std::byte> state) override;
+
 private:
   virtual void OnAction(const EventAction & action) override;
 
@@ -78,8 +89,22 @@ void SimpleGame::Tick(double deltaTime)
 {
   t += static_cast<float>(deltaTime);
   GenerateSignal(GameSignal::InvalidateRenderCache);
-  GameFramework::Log(GameFramework::LogMessageType::Info, "Tick: ", deltaTime * 1000.0,
-                     " FPS: ", 1.0 / deltaTime);
+  // once per second is enough to watch FPS, skipped frames are counted in the message
+  LOG_RATE_LIMITED(g_gameLog, LogMessageType::Info, 1.0, "Tick: ", deltaTime * 1000.0,
+                   " FPS: ", 1.0 / deltaTime);
+}
+
+std::vector<std::byte> SimpleGame::SerializeState() const
+{
+  std::vector<std::byte> state(sizeof(t));
+  std::memcpy(state.data(), &t, sizeof(t));
+  return state;
+}
+
+void SimpleGame::DeserializeState(std::span<const std::byte> state)
+{
+  if (state.size() == sizeof(t))
+    std::memcpy(&t, state.data(), sizeof(t));
 }
 
 void SimpleGame::Render(GameFramework::IDevice & device)
@@ -8,6 +8,7 @@
 #include <Assets/Asset.hpp>
 #include <Assets/Utils.hpp>
 #include <Files/FileManager.hpp>
+#include <Utility/Profiler.hpp>
 #include <Utility/StringUtils.hpp>
 
 namespace GameFramework
@@ -114,6 +115,7 @@ void AssetsRegistryImpl::SaveDatabase(const std::filesystem::path & path)
 
 void AssetsRegistryImpl::LoadDatabase(const std::filesystem::path & path)
 {
+  PROFILE_FUNCTION();
   if (FileReaderUPtr reader = GetFileManager().OpenRead(path))
   {
     std::vector<AssetUPtr> newAssets;
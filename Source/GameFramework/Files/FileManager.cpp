@@ -7,6 +7,8 @@
 #include <ranges>
 #include <stdexcept>
 
+#include <Utility/Profiler.hpp>
+
 namespace
 {
 size_t PathPrefixLength(const std::filesystem::path & dir,
@@ -70,6 +72,7 @@ void FileManagerImpl::Mount(std::filesystem::path shortPath, MountPointUPtr && m
 template<typename ResultT>
 ResultT FileManagerImpl::OpenImpl(const std::filesystem::path & path) const
 {
+  PROFILE_ZONE("FileManager::Open");
   if (path.empty())
     throw std::runtime_error("Invalid path");
 
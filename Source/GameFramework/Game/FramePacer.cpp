@@ -0,0 +1,76 @@
+#include "FramePacer.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <timeapi.h>
+#endif
+
+namespace GameFramework
+{
+using namespace std::chrono_literals;
+
+static constexpr std::chrono::steady_clock::duration g_minSpinThreshold = 500us;
+static constexpr std::chrono::steady_clock::duration g_maxSpinThreshold = 4ms;
+
+FramePacer::FramePacer(double targetFrameRate) noexcept
+  : m_spinThreshold(2ms)
+{
+#ifdef _WIN32
+  timeBeginPeriod(1);
+#endif
+  SetTargetFrameRate(targetFrameRate);
+}
+
+FramePacer::~FramePacer()
+{
+#ifdef _WIN32
+  timeEndPeriod(1);
+#endif
+}
+
+void FramePacer::SetTargetFrameRate(double targetFrameRate) noexcept
+{
+  m_targetFrameRate = std::max(targetFrameRate, 0.0);
+  m_period = m_targetFrameRate > 0.0
+               ? std::chrono::duration_cast<Clock::duration>(
+                   std::chrono::duration<double>(1.0 / m_targetFrameRate))
+               : Clock::duration::zero();
+}
+
+double FramePacer::Wait()
+{
+  const auto waitStart = Clock::now();
+  if (m_period == Clock::duration::zero())
+  {
+    m_frameStart = waitStart;
+    return 0.0;
+  }
+
+  const auto deadline = m_frameStart + m_period;
+  if (deadline - waitStart > m_spinThreshold)
+  {
+    const auto wakeUp = deadline - m_spinThreshold;
+    std::this_thread::sleep_until(wakeUp);
+    // threshold slowly goes down and jumps up when sleep was too long
+    const auto oversleep = Clock::now() - wakeUp;
+    m_spinThreshold = std::clamp(std::max(m_spinThreshold - m_spinThreshold / 16, oversleep * 2),
+                                 g_minSpinThreshold, g_maxSpinThreshold);
+  }
+  auto now = Clock::now();
+  while (now < deadline)
+  {
+    std::this_thread::yield();
+    now = Clock::now();
+  }
+
+  // if frame took too long, don't try to catch up with several short frames
+  m_frameStart = (now - deadline > m_period) ? now : deadline;
+  return std::chrono::duration<double>(now - waitStart).count();
+}
+
+} // namespace GameFramework
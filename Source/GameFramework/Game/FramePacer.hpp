@@ -0,0 +1,39 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <chrono>
+
+namespace GameFramework
+{
+
+/// @brief limits frame rate of the main loop.
+///        Sleeps the most of the remaining frame time and spins the rest of it, because sleep
+///        of OS wakes up too late. Spin threshold adapts to measured oversleep.
+///        On Windows timer resolution is raised to 1ms while pacer exists, otherwise sleep
+///        granularity is ~15.6ms and it's longer than the spin threshold
+class GAME_FRAMEWORK_API FramePacer final
+{
+  using Clock = std::chrono::steady_clock;
+
+public:
+  /// @param targetFrameRate - frames per second, 0 - unlimited
+  explicit FramePacer(double targetFrameRate = 0.0) noexcept;
+  ~FramePacer();
+  FramePacer(const FramePacer &) = delete;
+  FramePacer & operator=(const FramePacer &) = delete;
+
+  void SetTargetFrameRate(double targetFrameRate) noexcept;
+  double GetTargetFrameRate() const noexcept { return m_targetFrameRate; }
+
+  /// @brief blocks until the start of next frame
+  /// @return time of waiting in seconds
+  double Wait();
+
+private:
+  double m_targetFrameRate = 0.0;
+  Clock::duration m_period = Clock::duration::zero();
+  Clock::duration m_spinThreshold;
+  Clock::time_point m_frameStart = Clock::now();
+};
+
+} // namespace GameFramework
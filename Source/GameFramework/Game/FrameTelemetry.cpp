@@ -0,0 +1,163 @@
+#include "FrameTelemetry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <vector>
+
+namespace GameFramework
+{
+
+GAME_FRAMEWORK_API const char * ToString(FrameStage stage) noexcept
+{
+  switch (stage)
+  {
+    case FrameStage::Wait:
+      return "wait";
+    case FrameStage::Poll:
+      return "poll";
+    case FrameStage::Input:
+      return "input";
+    case FrameStage::Tick:
+      return "tick";
+    case FrameStage::Render:
+      return "render";
+    case FrameStage::Present:
+      return "present";
+    case FrameStage::Total:
+      return "total";
+  }
+  return "unknown";
+}
+
+void FrameTelemetry::Record(FrameStage stage, double seconds) noexcept
+{
+  m_current.stages[static_cast<size_t>(stage)] += seconds;
+}
+
+void FrameTelemetry::EndFrame() noexcept
+{
+  const auto now = Clock::now();
+  m_current.stages[static_cast<size_t>(FrameStage::Total)] =
+    std::chrono::duration<double>(now - m_frameStart).count();
+  m_frameStart = now;
+
+  m_frames[(m_head + m_count) % Capacity] = m_current;
+  if (m_count < Capacity)
+    m_count++;
+  else
+    m_head = (m_head + 1) % Capacity;
+  m_current = {};
+}
+
+void FrameTelemetry::Reset() noexcept
+{
+  m_head = 0;
+  m_count = 0;
+  m_current = {};
+  m_frameStart = Clock::now();
+}
+
+const FrameTimings & FrameTelemetry::GetFrame(size_t index) const noexcept
+{
+  return m_frames[(m_head + index) % Capacity];
+}
+
+namespace
+{
+std::vector<double> CollectSorted(const FrameTelemetry & telemetry, FrameStage stage)
+{
+  std::vector<double> values(telemetry.GetFramesCount());
+  for (size_t i = 0; i < values.size(); ++i)
+    values[i] = telemetry.GetFrame(i)[stage];
+  std::sort(values.begin(), values.end());
+  return values;
+}
+
+/// nearest-rank percentile of sorted values
+double Percentile(const std::vector<double> & sorted, double percentile) noexcept
+{
+  if (sorted.empty())
+    return 0.0;
+  const double rank = std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * sorted.size());
+  return sorted[std::clamp<size_t>(static_cast<size_t>(rank), 1, sorted.size()) - 1];
+}
+} // namespace
+
+double FrameTelemetry::GetPercentile(FrameStage stage, double percentile) const
+{
+  return Percentile(CollectSorted(*this, stage), percentile);
+}
+
+FrameStageStats FrameTelemetry::GetStats(FrameStage stage) const
+{
+  const auto values = CollectSorted(*this, stage);
+  if (values.empty())
+    return {};
+  FrameStageStats stats;
+  stats.min = values.front();
+  stats.max = values.back();
+  stats.average = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+  stats.p50 = Percentile(values, 50.0);
+  stats.p95 = Percentile(values, 95.0);
+  stats.p99 = Percentile(values, 99.0);
+  return stats;
+}
+
+bool FrameTelemetry::DumpCSV(const std::filesystem::path & path) const
+{
+  std::ofstream file(path);
+  if (!file)
+    return false;
+  for (size_t s = 0; s < FrameStagesCount; ++s)
+    file << (s == 0 ? "" : ",") << ToString(static_cast<FrameStage>(s));
+  file << '\n';
+  for (size_t i = 0; i < m_count; ++i)
+  {
+    auto && frame = GetFrame(i);
+    for (size_t s = 0; s < FrameStagesCount; ++s)
+      file << (s == 0 ? "" : ",") << frame.stages[s] * 1000.0;
+    file << '\n';
+  }
+  return static_cast<bool>(file);
+}
+
+bool FrameTelemetry::DumpJSON(const std::filesystem::path & path) const
+{
+  std::ofstream file(path);
+  if (!file)
+    return false;
+  file << "{\n  \"stages\": [";
+  for (size_t s = 0; s < FrameStagesCount; ++s)
+    file << (s == 0 ? "\"" : ", \"") << ToString(static_cast<FrameStage>(s)) << "\"";
+  file << "],\n  \"stats\": {";
+  for (size_t s = 0; s < FrameStagesCount; ++s)
+  {
+    const auto stats = GetStats(static_cast<FrameStage>(s));
+    file << (s == 0 ? "\n" : ",\n") << "    \"" << ToString(static_cast<FrameStage>(s))
+         << "\": {\"min\": " << stats.min * 1000.0 << ", \"max\": " << stats.max * 1000.0
+         << ", \"average\": " << stats.average * 1000.0 << ", \"p50\": " << stats.p50 * 1000.0
+         << ", \"p95\": " << stats.p95 * 1000.0 << ", \"p99\": " << stats.p99 * 1000.0 << "}";
+  }
+  file << "\n  },\n  \"frames\": [";
+  for (size_t i = 0; i < m_count; ++i)
+  {
+    auto && frame = GetFrame(i);
+    file << (i == 0 ? "\n    [" : ",\n    [");
+    for (size_t s = 0; s < FrameStagesCount; ++s)
+      file << (s == 0 ? "" : ", ") << frame.stages[s] * 1000.0;
+    file << "]";
+  }
+  file << "\n  ]\n}\n";
+  return static_cast<bool>(file);
+}
+
+static FrameTelemetry g_frameTelemetry;
+
+GAME_FRAMEWORK_API FrameTelemetry & GetFrameTelemetry()
+{
+  return g_frameTelemetry;
+}
+
+} // namespace GameFramework
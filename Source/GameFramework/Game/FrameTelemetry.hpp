@@ -0,0 +1,109 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+
+namespace GameFramework
+{
+
+/// @brief stages of the main loop which are measured
+enum class FrameStage : uint8_t
+{
+  Wait,    ///< frame limiter
+  Poll,    ///< window events
+  Input,   ///< input controllers and game input processing
+  Tick,    ///< game logic
+  Render,  ///< recording of the scenes
+  Present, ///< frame acquiring and submitting
+  Total,   ///< whole frame
+};
+inline constexpr size_t FrameStagesCount = static_cast<size_t>(FrameStage::Total) + 1;
+
+GAME_FRAMEWORK_API const char * ToString(FrameStage stage) noexcept;
+
+/// @brief CPU timings of one frame in seconds
+struct FrameTimings final
+{
+  std::array<double, FrameStagesCount> stages{};
+
+  double operator[](FrameStage stage) const noexcept
+  {
+    return stages[static_cast<size_t>(stage)];
+  }
+};
+
+/// @brief statistics of one stage over the stored frames, in seconds
+struct FrameStageStats final
+{
+  double min = 0.0;
+  double max = 0.0;
+  double average = 0.0;
+  double p50 = 0.0;
+  double p95 = 0.0;
+  double p99 = 0.0;
+};
+
+/// @brief ring buffer of timings of the last frames.
+///        Stages are measured on the main thread, so it's not thread-safe
+class GAME_FRAMEWORK_API FrameTelemetry final
+{
+  using Clock = std::chrono::steady_clock;
+
+public:
+  static constexpr size_t Capacity = 1024;
+
+  /// @brief measures time of the stage until destruction. Stage time is accumulated
+  ///        if it's measured several times in the frame
+  class StageScope final
+  {
+  public:
+    StageScope(FrameTelemetry & owner, FrameStage stage) noexcept
+      : m_owner(owner)
+      , m_stage(stage)
+    {
+    }
+    ~StageScope()
+    {
+      m_owner.Record(m_stage, std::chrono::duration<double>(Clock::now() - m_start).count());
+    }
+    StageScope(const StageScope &) = delete;
+    StageScope & operator=(const StageScope &) = delete;
+
+  private:
+    FrameTelemetry & m_owner;
+    FrameStage m_stage;
+    Clock::time_point m_start = Clock::now();
+  };
+
+public:
+  [[nodiscard]] StageScope Measure(FrameStage stage) noexcept { return StageScope(*this, stage); }
+  void Record(FrameStage stage, double seconds) noexcept;
+  /// @brief stores timings of the current frame and starts the next one
+  void EndFrame() noexcept;
+  void Reset() noexcept;
+
+  size_t GetFramesCount() const noexcept { return m_count; }
+  /// @param index - 0 is the oldest stored frame
+  const FrameTimings & GetFrame(size_t index) const noexcept;
+  /// @param percentile - in range [0, 100]
+  double GetPercentile(FrameStage stage, double percentile) const;
+  FrameStageStats GetStats(FrameStage stage) const;
+
+  /// @brief writes stored frames in milliseconds as CSV table (a row per frame)
+  bool DumpCSV(const std::filesystem::path & path) const;
+  /// @brief writes stored frames in milliseconds and stats as JSON object
+  bool DumpJSON(const std::filesystem::path & path) const;
+
+private:
+  std::array<FrameTimings, Capacity> m_frames;
+  size_t m_head = 0; ///< index of the oldest frame
+  size_t m_count = 0;
+  FrameTimings m_current;
+  Clock::time_point m_frameStart = Clock::now();
+};
+
+GAME_FRAMEWORK_API FrameTelemetry & GetFrameTelemetry();
+
+} // namespace GameFramework
@@ -0,0 +1,249 @@
+#include "MathBatch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include <Game/MathBatchKernels.hpp>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace GameFramework
+{
+namespace details
+{
+namespace
+{
+void MultiplyMatricesScalar(const Mat4f * lhs, size_t lhsStep, const Mat4f * rhs, Mat4f * result,
+                            size_t count) noexcept
+{
+  for (size_t i = 0; i < count; ++i, lhs += lhsStep)
+  {
+    // result is computed in temporary, so it can be the same as lhs or rhs
+    Mat4f r;
+    for (int col = 0; col < 4; ++col)
+    {
+      for (int row = 0; row < 4; ++row)
+      {
+        float sum = 0.0f;
+        for (int k = 0; k < 4; ++k)
+          sum += lhs->m[k * 4 + row] * rhs[i].m[col * 4 + k];
+        r.m[col * 4 + row] = sum;
+      }
+    }
+    result[i] = r;
+  }
+}
+
+void TransformVectorsScalar(const Mat4f & m, const Vec4f * vectors, Vec4f * result,
+                            size_t count) noexcept
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    const Vec4f v = vectors[i];
+    result[i] = {m.m[0] * v.x + m.m[4] * v.y + m.m[8] * v.z + m.m[12] * v.w,
+                 m.m[1] * v.x + m.m[5] * v.y + m.m[9] * v.z + m.m[13] * v.w,
+                 m.m[2] * v.x + m.m[6] * v.y + m.m[10] * v.z + m.m[14] * v.w,
+                 m.m[3] * v.x + m.m[7] * v.y + m.m[11] * v.z + m.m[15] * v.w};
+  }
+}
+
+void TransformAABBsScalar(const Mat4f & m, const AABBf * boxes, AABBf * result,
+                          size_t count) noexcept
+{
+  // center is transformed as a point, extent by absolute values of the matrix (J. Arvo)
+  for (size_t i = 0; i < count; ++i)
+  {
+    const float c[3] = {(boxes[i].min.x + boxes[i].max.x) * 0.5f,
+                        (boxes[i].min.y + boxes[i].max.y) * 0.5f,
+                        (boxes[i].min.z + boxes[i].max.z) * 0.5f};
+    const float e[3] = {(boxes[i].max.x - boxes[i].min.x) * 0.5f,
+                        (boxes[i].max.y - boxes[i].min.y) * 0.5f,
+                        (boxes[i].max.z - boxes[i].min.z) * 0.5f};
+    float newC[3], newE[3];
+    for (int row = 0; row < 3; ++row)
+    {
+      newC[row] = m.m[12 + row];
+      newE[row] = 0.0f;
+      for (int k = 0; k < 3; ++k)
+      {
+        newC[row] += m.m[k * 4 + row] * c[k];
+        newE[row] += std::abs(m.m[k * 4 + row]) * e[k];
+      }
+    }
+    result[i] = {{newC[0] - newE[0], newC[1] - newE[1], newC[2] - newE[2]},
+                 {newC[0] + newE[0], newC[1] + newE[1], newC[2] + newE[2]}};
+  }
+}
+
+void DotScalar(const float * ax, const float * ay, const float * az, const float * bx,
+               const float * by, const float * bz, float * result, size_t count) noexcept
+{
+  for (size_t i = 0; i < count; ++i)
+    result[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+}
+
+void CrossScalar(const float * ax, const float * ay, const float * az, const float * bx,
+                 const float * by, const float * bz, float * rx, float * ry, float * rz,
+                 size_t count) noexcept
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    const float x = ay[i] * bz[i] - az[i] * by[i];
+    const float y = az[i] * bx[i] - ax[i] * bz[i];
+    const float z = ax[i] * by[i] - ay[i] * bx[i];
+    rx[i] = x;
+    ry[i] = y;
+    rz[i] = z;
+  }
+}
+
+bool IsSimdLevelSupported(SimdLevel level) noexcept
+{
+  switch (level)
+  {
+    case SimdLevel::Scalar:
+      return true;
+#if defined(__x86_64__) || defined(_M_X64)
+    case SimdLevel::SSE:
+      return true;
+    case SimdLevel::AVX:
+#ifdef _MSC_VER
+    {
+      // CPU supports AVX and OS saves its registers
+      int info[4];
+      __cpuid(info, 1);
+      const bool osxsave = (info[2] & (1 << 27)) != 0;
+      const bool avx = (info[2] & (1 << 28)) != 0;
+      return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+    }
+#else
+      return __builtin_cpu_supports("avx");
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    case SimdLevel::NEON:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+const MathKernels & GetMathKernels(SimdLevel level) noexcept
+{
+  switch (level)
+  {
+#if defined(__x86_64__) || defined(_M_X64)
+    case SimdLevel::SSE:
+      return GetSSEMathKernels();
+    case SimdLevel::AVX:
+      return GetAVXMathKernels();
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    case SimdLevel::NEON:
+      return GetNEONMathKernels();
+#endif
+    default:
+      return GetScalarMathKernels();
+  }
+}
+
+SimdLevel DetectSimdLevel() noexcept
+{
+  for (auto level : {SimdLevel::AVX, SimdLevel::NEON, SimdLevel::SSE})
+  {
+    if (IsSimdLevelSupported(level))
+      return level;
+  }
+  return SimdLevel::Scalar;
+}
+
+struct MathDispatch final
+{
+  std::atomic<SimdLevel> level = DetectSimdLevel();
+  std::atomic<const MathKernels *> kernels = &GetMathKernels(level);
+};
+
+MathDispatch & GetMathDispatch() noexcept
+{
+  static MathDispatch s_dispatch;
+  return s_dispatch;
+}
+
+const MathKernels & Kernels() noexcept
+{
+  return *GetMathDispatch().kernels.load(std::memory_order_relaxed);
+}
+} // namespace
+
+const MathKernels & GetScalarMathKernels() noexcept
+{
+  static constexpr MathKernels s_kernels{&MultiplyMatricesScalar, &TransformVectorsScalar,
+                                         &TransformAABBsScalar, &DotScalar, &CrossScalar};
+  return s_kernels;
+}
+
+} // namespace details
+
+GAME_FRAMEWORK_API SimdLevel GetSimdLevel() noexcept
+{
+  return details::GetMathDispatch().level.load(std::memory_order_relaxed);
+}
+
+GAME_FRAMEWORK_API bool SetSimdLevel(SimdLevel level) noexcept
+{
+  if (!details::IsSimdLevelSupported(level))
+    return false;
+  auto && dispatch = details::GetMathDispatch();
+  dispatch.kernels.store(&details::GetMathKernels(level), std::memory_order_relaxed);
+  dispatch.level.store(level, std::memory_order_relaxed);
+  return true;
+}
+
+GAME_FRAMEWORK_API void MultiplyMatrices(std::span<const Mat4f> lhs, std::span<const Mat4f> rhs,
+                                         std::span<Mat4f> result) noexcept
+{
+  const size_t count = std::min({lhs.size(), rhs.size(), result.size()});
+  details::Kernels().multiplyMatrices(lhs.data(), 1, rhs.data(), result.data(), count);
+}
+
+GAME_FRAMEWORK_API void MultiplyMatrices(const Mat4f & lhs, std::span<const Mat4f> rhs,
+                                         std::span<Mat4f> result) noexcept
+{
+  const size_t count = std::min(rhs.size(), result.size());
+  details::Kernels().multiplyMatrices(&lhs, 0, rhs.data(), result.data(), count);
+}
+
+GAME_FRAMEWORK_API void TransformVectors(const Mat4f & m, std::span<const Vec4f> vectors,
+                                         std::span<Vec4f> result) noexcept
+{
+  const size_t count = std::min(vectors.size(), result.size());
+  details::Kernels().transformVectors(m, vectors.data(), result.data(), count);
+}
+
+GAME_FRAMEWORK_API void TransformAABBs(const Mat4f & m, std::span<const AABBf> boxes,
+                                       std::span<AABBf> result) noexcept
+{
+  const size_t count = std::min(boxes.size(), result.size());
+  details::Kernels().transformAABBs(m, boxes.data(), result.data(), count);
+}
+
+GAME_FRAMEWORK_API void Dot(ConstVec3fSoA a, ConstVec3fSoA b, std::span<float> result) noexcept
+{
+  const size_t count = std::min({a.size(), a.y.size(), a.z.size(), b.size(), b.y.size(),
+                                 b.z.size(), result.size()});
+  details::Kernels().dot(a.x.data(), a.y.data(), a.z.data(), b.x.data(), b.y.data(), b.z.data(),
+                         result.data(), count);
+}
+
+GAME_FRAMEWORK_API void Cross(ConstVec3fSoA a, ConstVec3fSoA b, Vec3fSoA result) noexcept
+{
+  const size_t count = std::min({a.size(), a.y.size(), a.z.size(), b.size(), b.y.size(),
+                                 b.z.size(), result.size(), result.y.size(), result.z.size()});
+  details::Kernels().cross(a.x.data(), a.y.data(), a.z.data(), b.x.data(), b.y.data(),
+                           b.z.data(), result.x.data(), result.y.data(), result.z.data(), count);
+}
+
+} // namespace GameFramework
@@ -0,0 +1,73 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <span>
+#include <type_traits>
+
+#include <Game/Math.hpp>
+
+namespace GameFramework
+{
+
+/// @brief axis-aligned bounding box
+struct GAME_FRAMEWORK_API AABBf
+{
+  Vec3f min;
+  Vec3f max;
+};
+
+/// @brief 3d vectors in SoA layout, all components have the same size
+template<typename T>
+struct Vec3SoA
+{
+  std::span<T> x, y, z;
+
+  size_t size() const noexcept { return x.size(); }
+  operator Vec3SoA<const T>() const noexcept
+    requires(!std::is_const_v<T>)
+  {
+    return {x, y, z};
+  }
+};
+
+using Vec3fSoA = Vec3SoA<float>;
+using ConstVec3fSoA = Vec3SoA<const float>;
+
+/// @brief instruction set of batched operations, it's detected on the first call
+enum class SimdLevel
+{
+  Scalar,
+  SSE, ///< SSE2, x86-64 baseline
+  AVX,
+  NEON,
+};
+
+GAME_FRAMEWORK_API SimdLevel GetSimdLevel() noexcept;
+/// @brief forces instruction set for tests and benchmarks
+/// @return false if it isn't supported by CPU, current level is kept then
+GAME_FRAMEWORK_API bool SetSimdLevel(SimdLevel level) noexcept;
+
+/*
+* Batched operations process whole spans with the best instruction set of CPU.
+* Matrices are column-major as in GLM. Result may be the same span as an argument, other overlaps
+* aren't allowed. Spans should have equal sizes, otherwise only the smallest size is processed
+*/
+
+/// @brief result[i] = lhs[i] * rhs[i]
+GAME_FRAMEWORK_API void MultiplyMatrices(std::span<const Mat4f> lhs, std::span<const Mat4f> rhs,
+                                         std::span<Mat4f> result) noexcept;
+/// @brief result[i] = lhs * rhs[i], e.g. view-projection by model matrices
+GAME_FRAMEWORK_API void MultiplyMatrices(const Mat4f & lhs, std::span<const Mat4f> rhs,
+                                         std::span<Mat4f> result) noexcept;
+/// @brief result[i] = m * vectors[i]
+GAME_FRAMEWORK_API void TransformVectors(const Mat4f & m, std::span<const Vec4f> vectors,
+                                         std::span<Vec4f> result) noexcept;
+/// @brief result[i] is the box which bounds transformed boxes[i], m must be affine
+GAME_FRAMEWORK_API void TransformAABBs(const Mat4f & m, std::span<const AABBf> boxes,
+                                       std::span<AABBf> result) noexcept;
+/// @brief result[i] = dot(a[i], b[i])
+GAME_FRAMEWORK_API void Dot(ConstVec3fSoA a, ConstVec3fSoA b, std::span<float> result) noexcept;
+/// @brief result[i] = cross(a[i], b[i])
+GAME_FRAMEWORK_API void Cross(ConstVec3fSoA a, ConstVec3fSoA b, Vec3fSoA result) noexcept;
+
+} // namespace GameFramework
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+
+#include <Game/MathBatch.hpp>
+
+namespace GameFramework::details
+{
+
+/// @brief implementation of batched operations for one instruction set
+struct MathKernels final
+{
+  /// lhsStep is 0 if the same lhs is used for all matrices and 1 otherwise
+  void (*multiplyMatrices)(const Mat4f * lhs, size_t lhsStep, const Mat4f * rhs, Mat4f * result,
+                           size_t count) noexcept;
+  void (*transformVectors)(const Mat4f & m, const Vec4f * vectors, Vec4f * result,
+                           size_t count) noexcept;
+  void (*transformAABBs)(const Mat4f & m, const AABBf * boxes, AABBf * result,
+                         size_t count) noexcept;
+  void (*dot)(const float * ax, const float * ay, const float * az, const float * bx,
+              const float * by, const float * bz, float * result, size_t count) noexcept;
+  void (*cross)(const float * ax, const float * ay, const float * az, const float * bx,
+                const float * by, const float * bz, float * rx, float * ry, float * rz,
+                size_t count) noexcept;
+};
+
+/// kernels of each instruction set are compiled in their own file with the flags of that set
+const MathKernels & GetScalarMathKernels() noexcept;
+#if defined(__x86_64__) || defined(_M_X64)
+const MathKernels & GetSSEMathKernels() noexcept;
+const MathKernels & GetAVXMathKernels() noexcept;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+const MathKernels & GetNEONMathKernels() noexcept;
+#endif
+
+} // namespace GameFramework::details
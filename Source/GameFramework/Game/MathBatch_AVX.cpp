@@ -0,0 +1,104 @@
+// compiled with AVX enabled, it's called only if CPU supports AVX
+#include <Game/MathBatchKernels.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+
+namespace GameFramework::details
+{
+namespace
+{
+/// transforms two vectors at once, each 128-bit lane of c holds the same column
+inline __m256 Transform(const __m256 (&c)[4], __m256 v) noexcept
+{
+  __m256 r = _mm256_mul_ps(c[0], _mm256_permute_ps(v, 0x00));
+  r = _mm256_add_ps(r, _mm256_mul_ps(c[1], _mm256_permute_ps(v, 0x55)));
+  r = _mm256_add_ps(r, _mm256_mul_ps(c[2], _mm256_permute_ps(v, 0xAA)));
+  return _mm256_add_ps(r, _mm256_mul_ps(c[3], _mm256_permute_ps(v, 0xFF)));
+}
+
+inline void BroadcastColumns(const Mat4f & m, __m256 (&c)[4]) noexcept
+{
+  for (int i = 0; i < 4; ++i)
+    c[i] = _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(m.m + i * 4));
+}
+
+void MultiplyMatricesAVX(const Mat4f * lhs, size_t lhsStep, const Mat4f * rhs, Mat4f * result,
+                         size_t count) noexcept
+{
+  __m256 l[4];
+  BroadcastColumns(*lhs, l);
+  for (size_t i = 0; i < count; ++i, lhs += lhsStep)
+  {
+    if (lhsStep != 0)
+      BroadcastColumns(*lhs, l);
+    // two columns of rhs are transformed at once
+    const __m256 r01 = _mm256_loadu_ps(rhs[i].m);
+    const __m256 r23 = _mm256_loadu_ps(rhs[i].m + 8);
+    _mm256_storeu_ps(result[i].m, Transform(l, r01));
+    _mm256_storeu_ps(result[i].m + 8, Transform(l, r23));
+  }
+  _mm256_zeroupper();
+}
+
+void TransformVectorsAVX(const Mat4f & m, const Vec4f * vectors, Vec4f * result,
+                         size_t count) noexcept
+{
+  __m256 c[4];
+  BroadcastColumns(m, c);
+  size_t i = 0;
+  for (; i + 2 <= count; i += 2)
+    _mm256_storeu_ps(&result[i].x, Transform(c, _mm256_loadu_ps(&vectors[i].x)));
+  _mm256_zeroupper();
+  GetSSEMathKernels().transformVectors(m, vectors + i, result + i, count - i);
+}
+
+void DotAVX(const float * ax, const float * ay, const float * az, const float * bx,
+            const float * by, const float * bz, float * result, size_t count) noexcept
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256 r = _mm256_mul_ps(_mm256_loadu_ps(ax + i), _mm256_loadu_ps(bx + i));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_loadu_ps(ay + i), _mm256_loadu_ps(by + i)));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_loadu_ps(az + i), _mm256_loadu_ps(bz + i)));
+    _mm256_storeu_ps(result + i, r);
+  }
+  _mm256_zeroupper();
+  GetSSEMathKernels().dot(ax + i, ay + i, az + i, bx + i, by + i, bz + i, result + i, count - i);
+}
+
+void CrossAVX(const float * ax, const float * ay, const float * az, const float * bx,
+              const float * by, const float * bz, float * rx, float * ry, float * rz,
+              size_t count) noexcept
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256 x1 = _mm256_loadu_ps(ax + i);
+    const __m256 y1 = _mm256_loadu_ps(ay + i);
+    const __m256 z1 = _mm256_loadu_ps(az + i);
+    const __m256 x2 = _mm256_loadu_ps(bx + i);
+    const __m256 y2 = _mm256_loadu_ps(by + i);
+    const __m256 z2 = _mm256_loadu_ps(bz + i);
+    _mm256_storeu_ps(rx + i, _mm256_sub_ps(_mm256_mul_ps(y1, z2), _mm256_mul_ps(z1, y2)));
+    _mm256_storeu_ps(ry + i, _mm256_sub_ps(_mm256_mul_ps(z1, x2), _mm256_mul_ps(x1, z2)));
+    _mm256_storeu_ps(rz + i, _mm256_sub_ps(_mm256_mul_ps(x1, y2), _mm256_mul_ps(y1, x2)));
+  }
+  _mm256_zeroupper();
+  GetSSEMathKernels().cross(ax + i, ay + i, az + i, bx + i, by + i, bz + i, rx + i, ry + i,
+                            rz + i, count - i);
+}
+} // namespace
+
+const MathKernels & GetAVXMathKernels() noexcept
+{
+  // boxes are 3-component, so they don't gain from wider registers
+  static const MathKernels s_kernels{&MultiplyMatricesAVX, &TransformVectorsAVX,
+                                     GetSSEMathKernels().transformAABBs, &DotAVX, &CrossAVX};
+  return s_kernels;
+}
+
+} // namespace GameFramework::details
+
+#endif
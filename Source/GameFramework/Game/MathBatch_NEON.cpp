@@ -0,0 +1,124 @@
+#include <Game/MathBatchKernels.hpp>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+
+namespace GameFramework::details
+{
+namespace
+{
+/// r = c0 * v.x + c1 * v.y + c2 * v.z + c3 * v.w
+inline float32x4_t Transform(const float32x4_t (&c)[4], float32x4_t v) noexcept
+{
+  float32x4_t r = vmulq_laneq_f32(c[0], v, 0);
+  r = vfmaq_laneq_f32(r, c[1], v, 1);
+  r = vfmaq_laneq_f32(r, c[2], v, 2);
+  return vfmaq_laneq_f32(r, c[3], v, 3);
+}
+
+inline void LoadColumns(const Mat4f & m, float32x4_t (&c)[4]) noexcept
+{
+  for (int i = 0; i < 4; ++i)
+    c[i] = vld1q_f32(m.m + i * 4);
+}
+
+void MultiplyMatricesNEON(const Mat4f * lhs, size_t lhsStep, const Mat4f * rhs, Mat4f * result,
+                          size_t count) noexcept
+{
+  float32x4_t l[4];
+  LoadColumns(*lhs, l);
+  for (size_t i = 0; i < count; ++i, lhs += lhsStep)
+  {
+    if (lhsStep != 0)
+      LoadColumns(*lhs, l);
+    float32x4_t r[4];
+    LoadColumns(rhs[i], r);
+    for (int c = 0; c < 4; ++c)
+      vst1q_f32(result[i].m + c * 4, Transform(l, r[c]));
+  }
+}
+
+void TransformVectorsNEON(const Mat4f & m, const Vec4f * vectors, Vec4f * result,
+                          size_t count) noexcept
+{
+  float32x4_t c[4];
+  LoadColumns(m, c);
+  for (size_t i = 0; i < count; ++i)
+    vst1q_f32(&result[i].x, Transform(c, vld1q_f32(&vectors[i].x)));
+}
+
+void TransformAABBsNEON(const Mat4f & m, const AABBf * boxes, AABBf * result,
+                        size_t count) noexcept
+{
+  float32x4_t c[4], a[3];
+  LoadColumns(m, c);
+  for (int i = 0; i < 3; ++i)
+    a[i] = vabsq_f32(c[i]);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const AABBf & box = boxes[i];
+    const float minValues[4] = {box.min.x, box.min.y, box.min.z, 0.0f};
+    const float maxValues[4] = {box.max.x, box.max.y, box.max.z, 0.0f};
+    const float32x4_t min = vld1q_f32(minValues);
+    const float32x4_t max = vld1q_f32(maxValues);
+    const float32x4_t center = vmulq_n_f32(vaddq_f32(min, max), 0.5f);
+    const float32x4_t extent = vmulq_n_f32(vsubq_f32(max, min), 0.5f);
+
+    float32x4_t newCenter = vfmaq_laneq_f32(c[3], c[0], center, 0);
+    newCenter = vfmaq_laneq_f32(newCenter, c[1], center, 1);
+    newCenter = vfmaq_laneq_f32(newCenter, c[2], center, 2);
+    float32x4_t newExtent = vmulq_laneq_f32(a[0], extent, 0);
+    newExtent = vfmaq_laneq_f32(newExtent, a[1], extent, 1);
+    newExtent = vfmaq_laneq_f32(newExtent, a[2], extent, 2);
+
+    float newMin[4], newMax[4];
+    vst1q_f32(newMin, vsubq_f32(newCenter, newExtent));
+    vst1q_f32(newMax, vaddq_f32(newCenter, newExtent));
+    result[i] = {{newMin[0], newMin[1], newMin[2]}, {newMax[0], newMax[1], newMax[2]}};
+  }
+}
+
+void DotNEON(const float * ax, const float * ay, const float * az, const float * bx,
+             const float * by, const float * bz, float * result, size_t count) noexcept
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    float32x4_t r = vmulq_f32(vld1q_f32(ax + i), vld1q_f32(bx + i));
+    r = vfmaq_f32(r, vld1q_f32(ay + i), vld1q_f32(by + i));
+    r = vfmaq_f32(r, vld1q_f32(az + i), vld1q_f32(bz + i));
+    vst1q_f32(result + i, r);
+  }
+  GetScalarMathKernels().dot(ax + i, ay + i, az + i, bx + i, by + i, bz + i, result + i,
+                             count - i);
+}
+
+void CrossNEON(const float * ax, const float * ay, const float * az, const float * bx,
+               const float * by, const float * bz, float * rx, float * ry, float * rz,
+               size_t count) noexcept
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const float32x4_t x1 = vld1q_f32(ax + i), y1 = vld1q_f32(ay + i), z1 = vld1q_f32(az + i);
+    const float32x4_t x2 = vld1q_f32(bx + i), y2 = vld1q_f32(by + i), z2 = vld1q_f32(bz + i);
+    vst1q_f32(rx + i, vfmsq_f32(vmulq_f32(y1, z2), z1, y2));
+    vst1q_f32(ry + i, vfmsq_f32(vmulq_f32(z1, x2), x1, z2));
+    vst1q_f32(rz + i, vfmsq_f32(vmulq_f32(x1, y2), y1, x2));
+  }
+  GetScalarMathKernels().cross(ax + i, ay + i, az + i, bx + i, by + i, bz + i, rx + i, ry + i,
+                               rz + i, count - i);
+}
+} // namespace
+
+const MathKernels & GetNEONMathKernels() noexcept
+{
+  static constexpr MathKernels s_kernels{&MultiplyMatricesNEON, &TransformVectorsNEON,
+                                         &TransformAABBsNEON, &DotNEON, &CrossNEON};
+  return s_kernels;
+}
+
+} // namespace GameFramework::details
+
+#endif
@@ -0,0 +1,124 @@
+#include <Game/MathBatchKernels.hpp>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+
+namespace GameFramework::details
+{
+namespace
+{
+/// r = c0 * v.x + c1 * v.y + c2 * v.z + c3 * v.w
+inline __m128 Transform(const __m128 (&c)[4], __m128 v) noexcept
+{
+  __m128 r = _mm_mul_ps(c[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+  r = _mm_add_ps(r, _mm_mul_ps(c[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+  r = _mm_add_ps(r, _mm_mul_ps(c[2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+  return _mm_add_ps(r, _mm_mul_ps(c[3], _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+}
+
+inline void LoadColumns(const Mat4f & m, __m128 (&c)[4]) noexcept
+{
+  for (int i = 0; i < 4; ++i)
+    c[i] = _mm_loadu_ps(m.m + i * 4);
+}
+
+void MultiplyMatricesSSE(const Mat4f * lhs, size_t lhsStep, const Mat4f * rhs, Mat4f * result,
+                         size_t count) noexcept
+{
+  __m128 l[4];
+  LoadColumns(*lhs, l);
+  for (size_t i = 0; i < count; ++i, lhs += lhsStep)
+  {
+    if (lhsStep != 0)
+      LoadColumns(*lhs, l);
+    __m128 r[4];
+    LoadColumns(rhs[i], r);
+    for (int c = 0; c < 4; ++c)
+      _mm_storeu_ps(result[i].m + c * 4, Transform(l, r[c]));
+  }
+}
+
+void TransformVectorsSSE(const Mat4f & m, const Vec4f * vectors, Vec4f * result,
+                         size_t count) noexcept
+{
+  __m128 c[4];
+  LoadColumns(m, c);
+  for (size_t i = 0; i < count; ++i)
+    _mm_storeu_ps(&result[i].x, Transform(c, _mm_loadu_ps(&vectors[i].x)));
+}
+
+void TransformAABBsSSE(const Mat4f & m, const AABBf * boxes, AABBf * result,
+                       size_t count) noexcept
+{
+  const __m128 signMask = _mm_set1_ps(-0.0f);
+  const __m128 half = _mm_set1_ps(0.5f);
+  __m128 c[4], a[3];
+  LoadColumns(m, c);
+  for (int i = 0; i < 3; ++i)
+    a[i] = _mm_andnot_ps(signMask, c[i]);
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const AABBf & box = boxes[i];
+    const __m128 min = _mm_setr_ps(box.min.x, box.min.y, box.min.z, 0.0f);
+    const __m128 max = _mm_setr_ps(box.max.x, box.max.y, box.max.z, 0.0f);
+    const __m128 center = _mm_mul_ps(_mm_add_ps(min, max), half);
+    const __m128 extent = _mm_mul_ps(_mm_sub_ps(max, min), half);
+
+    __m128 newCenter = _mm_add_ps(c[3], _mm_mul_ps(c[0], _mm_shuffle_ps(center, center, 0x00)));
+    newCenter = _mm_add_ps(newCenter, _mm_mul_ps(c[1], _mm_shuffle_ps(center, center, 0x55)));
+    newCenter = _mm_add_ps(newCenter, _mm_mul_ps(c[2], _mm_shuffle_ps(center, center, 0xAA)));
+    __m128 newExtent = _mm_mul_ps(a[0], _mm_shuffle_ps(extent, extent, 0x00));
+    newExtent = _mm_add_ps(newExtent, _mm_mul_ps(a[1], _mm_shuffle_ps(extent, extent, 0x55)));
+    newExtent = _mm_add_ps(newExtent, _mm_mul_ps(a[2], _mm_shuffle_ps(extent, extent, 0xAA)));
+
+    alignas(16) float newMin[4], newMax[4];
+    _mm_store_ps(newMin, _mm_sub_ps(newCenter, newExtent));
+    _mm_store_ps(newMax, _mm_add_ps(newCenter, newExtent));
+    result[i] = {{newMin[0], newMin[1], newMin[2]}, {newMax[0], newMax[1], newMax[2]}};
+  }
+}
+
+void DotSSE(const float * ax, const float * ay, const float * az, const float * bx,
+            const float * by, const float * bz, float * result, size_t count) noexcept
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128 r = _mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i)));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i)));
+    _mm_storeu_ps(result + i, r);
+  }
+  GetScalarMathKernels().dot(ax + i, ay + i, az + i, bx + i, by + i, bz + i, result + i,
+                             count - i);
+}
+
+void CrossSSE(const float * ax, const float * ay, const float * az, const float * bx,
+              const float * by, const float * bz, float * rx, float * ry, float * rz,
+              size_t count) noexcept
+{
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 x1 = _mm_loadu_ps(ax + i), y1 = _mm_loadu_ps(ay + i), z1 = _mm_loadu_ps(az + i);
+    const __m128 x2 = _mm_loadu_ps(bx + i), y2 = _mm_loadu_ps(by + i), z2 = _mm_loadu_ps(bz + i);
+    _mm_storeu_ps(rx + i, _mm_sub_ps(_mm_mul_ps(y1, z2), _mm_mul_ps(z1, y2)));
+    _mm_storeu_ps(ry + i, _mm_sub_ps(_mm_mul_ps(z1, x2), _mm_mul_ps(x1, z2)));
+    _mm_storeu_ps(rz + i, _mm_sub_ps(_mm_mul_ps(x1, y2), _mm_mul_ps(y1, x2)));
+  }
+  GetScalarMathKernels().cross(ax + i, ay + i, az + i, bx + i, by + i, bz + i, rx + i, ry + i,
+                               rz + i, count - i);
+}
+} // namespace
+
+const MathKernels & GetSSEMathKernels() noexcept
+{
+  static constexpr MathKernels s_kernels{&MultiplyMatricesSSE, &TransformVectorsSSE,
+                                         &TransformAABBsSSE, &DotSSE, &CrossSSE};
+  return s_kernels;
+}
+
+} // namespace GameFramework::details
+
+#endif
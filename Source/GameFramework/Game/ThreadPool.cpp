@@ -0,0 +1,140 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <Utility/Profiler.hpp>
+
+namespace GameFramework
+{
+
+class StdThreadPool final : public ThreadPool
+{
+public:
+  explicit StdThreadPool(size_t workersCount);
+  virtual ~StdThreadPool() override;
+
+  virtual void Enqueue(std::function<void()> && task) override;
+  virtual void ParallelFor(size_t count, const std::function<void(size_t)> & task) override;
+  virtual size_t GetWorkersCount() const noexcept override { return m_workers.size(); }
+
+private:
+  std::vector<std::thread> m_workers;
+  std::deque<std::function<void()>> m_tasks;
+  std::mutex m_mutex;
+  std::condition_variable m_hasTasks;
+  bool m_stop = false;
+
+private:
+  void WorkerLoop();
+};
+
+StdThreadPool::StdThreadPool(size_t workersCount)
+{
+  m_workers.reserve(workersCount);
+  for (size_t i = 0; i < workersCount; ++i)
+    m_workers.emplace_back(&StdThreadPool::WorkerLoop, this);
+}
+
+StdThreadPool::~StdThreadPool()
+{
+  {
+    std::lock_guard lk{m_mutex};
+    m_stop = true;
+  }
+  m_hasTasks.notify_all();
+  for (auto && worker : m_workers)
+    worker.join();
+}
+
+void StdThreadPool::Enqueue(std::function<void()> && task)
+{
+  {
+    std::lock_guard lk{m_mutex};
+    m_tasks.push_back(std::move(task));
+  }
+  m_hasTasks.notify_one();
+}
+
+void StdThreadPool::ParallelFor(size_t count, const std::function<void(size_t)> & task)
+{
+  if (count == 0)
+    return;
+
+  // state is shared because helpers can start after all iterations are done
+  struct State
+  {
+    const std::function<void(size_t)> * task;
+    size_t count;
+    std::atomic<size_t> next = 0;
+    std::atomic<size_t> done = 0;
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    void Run()
+    {
+      for (size_t i = next++; i < count; i = next++)
+      {
+        try
+        {
+          (*task)(i);
+        }
+        catch (...)
+        {
+          std::lock_guard lk{errorMutex};
+          if (!error)
+            error = std::current_exception();
+        }
+        if (++done == count)
+          done.notify_all();
+      }
+    }
+  };
+
+  auto state = std::make_shared<State>();
+  state->task = &task;
+  state->count = count;
+
+  const size_t helpersCount = std::min(count - 1, m_workers.size());
+  for (size_t i = 0; i < helpersCount; ++i)
+    Enqueue([state] { state->Run(); });
+  state->Run();
+
+  for (size_t done = state->done; done != count; done = state->done)
+    state->done.wait(done);
+
+  if (state->error)
+    std::rethrow_exception(state->error);
+}
+
+void StdThreadPool::WorkerLoop()
+{
+  GetProfiler().SetThreadName("Worker");
+  while (true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock lk{m_mutex};
+      m_hasTasks.wait(lk, [this] { return m_stop || !m_tasks.empty(); });
+      if (m_stop && m_tasks.empty())
+        return;
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+    task();
+  }
+}
+
+GAME_FRAMEWORK_API ThreadPool & GetThreadPool()
+{
+  static StdThreadPool s_threadPool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+  return s_threadPool;
+}
+} // namespace GameFramework
@@ -0,0 +1,23 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <functional>
+
+namespace GameFramework
+{
+
+/// @brief pool of worker threads for short tasks of the frame
+struct ThreadPool
+{
+  virtual ~ThreadPool() = default;
+  /// @brief run task on some worker thread
+  virtual void Enqueue(std::function<void()> && task) = 0;
+  /// @brief call task(i) for every i in [0, count) in parallel and wait for all of them.
+  ///        Calling thread executes tasks too. First thrown exception is rethrown
+  virtual void ParallelFor(size_t count, const std::function<void(size_t)> & task) = 0;
+  virtual size_t GetWorkersCount() const noexcept = 0;
+};
+
+GAME_FRAMEWORK_API ThreadPool & GetThreadPool();
+
+} // namespace GameFramework
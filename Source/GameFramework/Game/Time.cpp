@@ -16,6 +16,10 @@ public:
   virtual void Tick() override;
   virtual double Now() const noexcept override { return m_cachedNow; }
   virtual double Delta() const noexcept override { return m_cachedDelta; }
+  virtual double Timestamp() const noexcept override
+  {
+    return Duration(Clock::now() - m_appStart).count();
+  }
 
 private:
   const TimePoint m_appStart = Clock::now(); // time of start application
@@ -10,6 +10,8 @@ struct TimeManager
   virtual void Tick() = 0;
   virtual double Now() const noexcept = 0;
   virtual double Delta() const noexcept = 0;
+  /// @brief current time in the same clock as Now(), but it isn't cached on Tick
+  virtual double Timestamp() const noexcept = 0;
 };
 
 GAME_FRAMEWORK_API TimeManager & GetTimeManager();
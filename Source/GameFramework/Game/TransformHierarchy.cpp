@@ -0,0 +1,331 @@
+#include "TransformHierarchy.hpp"
+
+#include <algorithm>
+#include <span>
+
+#include <Game/MathBatch.hpp>
+#include <Game/ThreadPool.hpp>
+#include <Utility/Profiler.hpp>
+
+namespace GameFramework
+{
+namespace
+{
+/// nodes of one level are split into tasks of this size
+constexpr size_t s_nodesPerTask = 256;
+} // namespace
+
+GAME_FRAMEWORK_API Mat4f ToMatrix(const Transform & transform) noexcept
+{
+  const Vec4f & q = transform.rotation;
+  const Vec3f & s = transform.scale;
+  const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+  const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+  Mat4f m;
+  m.m[0] = (1.0f - 2.0f * (yy + zz)) * s.x;
+  m.m[1] = 2.0f * (xy + wz) * s.x;
+  m.m[2] = 2.0f * (xz - wy) * s.x;
+  m.m[4] = 2.0f * (xy - wz) * s.y;
+  m.m[5] = (1.0f - 2.0f * (xx + zz)) * s.y;
+  m.m[6] = 2.0f * (yz + wx) * s.y;
+  m.m[8] = 2.0f * (xz + wy) * s.z;
+  m.m[9] = 2.0f * (yz - wx) * s.z;
+  m.m[10] = (1.0f - 2.0f * (xx + yy)) * s.z;
+  m.m[12] = transform.translation.x;
+  m.m[13] = transform.translation.y;
+  m.m[14] = transform.translation.z;
+  return m;
+}
+
+TransformHandle TransformHierarchy::Create(const Transform & local, TransformHandle parent)
+{
+  const Slot * parentSlot = FindSlot(parent);
+  const uint32_t parentIndex = parentSlot ? parent.index : InvalidIndex;
+  const uint32_t depth = parentSlot ? parentSlot->depth + 1 : 0;
+
+  uint32_t slotIndex;
+  if (!m_freeSlots.empty())
+  {
+    slotIndex = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  }
+  else
+  {
+    slotIndex = static_cast<uint32_t>(m_slots.size());
+    m_slots.emplace_back();
+  }
+
+  Insert(slotIndex, depth, local);
+  Link(slotIndex, parentIndex);
+  MarkDirty(slotIndex);
+  m_size++;
+  return {slotIndex, m_slots[slotIndex].generation};
+}
+
+void TransformHierarchy::Destroy(TransformHandle handle)
+{
+  if (!FindSlot(handle))
+    return;
+
+  Unlink(handle.index);
+  // children are appended while the subtree is walked
+  std::vector<uint32_t> subtree{handle.index};
+  for (size_t i = 0; i < subtree.size(); ++i)
+  {
+    for (uint32_t child = m_slots[subtree[i]].firstChild; child != InvalidIndex;
+         child = m_slots[child].nextSibling)
+      subtree.push_back(child);
+  }
+
+  for (uint32_t slotIndex : subtree)
+  {
+    Extract(slotIndex);
+    Slot & slot = m_slots[slotIndex];
+    slot = Slot{slot.generation + 1};
+    m_freeSlots.push_back(slotIndex);
+  }
+  m_size -= subtree.size();
+}
+
+bool TransformHierarchy::IsAlive(TransformHandle handle) const noexcept
+{
+  return FindSlot(handle) != nullptr;
+}
+
+void TransformHierarchy::SetLocal(TransformHandle handle, const Transform & local)
+{
+  if (const Slot * slot = FindSlot(handle))
+  {
+    m_levels[slot->depth].locals[slot->denseIndex] = local;
+    MarkDirty(handle.index);
+  }
+}
+
+const Transform & TransformHierarchy::GetLocal(TransformHandle handle) const noexcept
+{
+  static const Transform s_default;
+  const Slot * slot = FindSlot(handle);
+  return slot ? m_levels[slot->depth].locals[slot->denseIndex] : s_default;
+}
+
+bool TransformHierarchy::SetParent(TransformHandle handle, TransformHandle parent)
+{
+  const Slot * slot = FindSlot(handle);
+  if (!slot)
+    return false;
+
+  const Slot * parentSlot = FindSlot(parent);
+  const uint32_t parentIndex = parentSlot ? parent.index : InvalidIndex;
+  for (uint32_t ancestor = parentIndex; ancestor != InvalidIndex;
+       ancestor = m_slots[ancestor].parent)
+  {
+    if (ancestor == handle.index)
+      return false;
+  }
+  if (slot->parent == parentIndex)
+    return true;
+
+  const uint32_t depth = parentSlot ? parentSlot->depth + 1 : 0;
+  const uint32_t oldDepth = slot->depth;
+  Unlink(handle.index);
+  Link(handle.index, parentIndex);
+
+  if (depth != oldDepth)
+  {
+    // whole subtree goes to other levels, parents are moved before their children
+    std::vector<uint32_t> subtree{handle.index};
+    for (size_t i = 0; i < subtree.size(); ++i)
+    {
+      const uint32_t slotIndex = subtree[i];
+      const uint32_t newDepth = i == 0 ? depth : m_slots[m_slots[slotIndex].parent].depth + 1;
+      Insert(slotIndex, newDepth, Extract(slotIndex));
+      for (uint32_t child = m_slots[slotIndex].firstChild; child != InvalidIndex;
+           child = m_slots[child].nextSibling)
+        subtree.push_back(child);
+    }
+  }
+  MarkDirty(handle.index);
+  return true;
+}
+
+TransformHandle TransformHierarchy::GetParent(TransformHandle handle) const noexcept
+{
+  const Slot * slot = FindSlot(handle);
+  if (!slot || slot->parent == InvalidIndex)
+    return {};
+  return {slot->parent, m_slots[slot->parent].generation};
+}
+
+void TransformHierarchy::Update()
+{
+  PROFILE_FUNCTION();
+  m_updatedCount = 0;
+  for (size_t depth = 0; depth < m_levels.size(); ++depth)
+  {
+    Level & level = m_levels[depth];
+    m_batch.clear();
+    for (uint32_t slotIndex : level.dirty)
+    {
+      // nodes could be marked twice, destroyed or moved to other level since marking
+      Slot & slot = m_slots[slotIndex];
+      if (slot.dirty && slot.depth == depth)
+      {
+        slot.dirty = false;
+        m_batch.push_back(slotIndex);
+      }
+    }
+    level.dirty.clear();
+    if (m_batch.empty())
+      continue;
+
+    m_parentMatrices.resize(m_batch.size());
+    m_resultMatrices.resize(m_batch.size());
+    const Level * parentLevel = depth > 0 ? &m_levels[depth - 1] : nullptr;
+    const size_t tasksCount = (m_batch.size() + s_nodesPerTask - 1) / s_nodesPerTask;
+    if (tasksCount == 1)
+    {
+      UpdateBatch(parentLevel, level, 0, m_batch.size());
+    }
+    else
+    {
+      GetThreadPool().ParallelFor(tasksCount,
+                                  [&](size_t task)
+                                  {
+                                    const size_t first = task * s_nodesPerTask;
+                                    UpdateBatch(parentLevel, level, first,
+                                                std::min(s_nodesPerTask, m_batch.size() - first));
+                                  });
+    }
+
+    // children depend on the new world matrices, they are updated with the next level
+    for (uint32_t slotIndex : m_batch)
+    {
+      for (uint32_t child = m_slots[slotIndex].firstChild; child != InvalidIndex;
+           child = m_slots[child].nextSibling)
+        MarkDirty(child);
+    }
+    m_updatedCount += m_batch.size();
+  }
+}
+
+const Mat4f & TransformHierarchy::GetWorldMatrix(TransformHandle handle) const noexcept
+{
+  static const Mat4f s_identity;
+  const Slot * slot = FindSlot(handle);
+  return slot ? m_levels[slot->depth].worlds[slot->denseIndex] : s_identity;
+}
+
+const TransformHierarchy::Slot * TransformHierarchy::FindSlot(
+  TransformHandle handle) const noexcept
+{
+  if (!handle.IsValid() || handle.index >= m_slots.size())
+    return nullptr;
+  const Slot & slot = m_slots[handle.index];
+  if (slot.generation != handle.generation || slot.denseIndex == InvalidIndex)
+    return nullptr;
+  return &slot;
+}
+
+void TransformHierarchy::MarkDirty(uint32_t slotIndex)
+{
+  Slot & slot = m_slots[slotIndex];
+  if (!slot.dirty)
+  {
+    slot.dirty = true;
+    m_levels[slot.depth].dirty.push_back(slotIndex);
+  }
+}
+
+void TransformHierarchy::Insert(uint32_t slotIndex, uint32_t depth, const Transform & local)
+{
+  if (depth >= m_levels.size())
+    m_levels.resize(depth + 1);
+  Level & level = m_levels[depth];
+  Slot & slot = m_slots[slotIndex];
+  slot.depth = depth;
+  slot.denseIndex = static_cast<uint32_t>(level.slots.size());
+  // old dirty entry belongs to other level, node is marked again by caller or its parent
+  slot.dirty = false;
+  level.locals.push_back(local);
+  level.worlds.emplace_back();
+  level.slots.push_back(slotIndex);
+}
+
+Transform TransformHierarchy::Extract(uint32_t slotIndex)
+{
+  Slot & slot = m_slots[slotIndex];
+  Level & level = m_levels[slot.depth];
+  const uint32_t removedIndex = slot.denseIndex;
+  const Transform local = level.locals[removedIndex];
+
+  // move last node on place of removed one to keep arrays dense
+  const uint32_t lastIndex = static_cast<uint32_t>(level.slots.size() - 1);
+  if (removedIndex != lastIndex)
+  {
+    level.locals[removedIndex] = level.locals[lastIndex];
+    level.worlds[removedIndex] = level.worlds[lastIndex];
+    level.slots[removedIndex] = level.slots[lastIndex];
+    m_slots[level.slots[removedIndex]].denseIndex = removedIndex;
+  }
+  level.locals.pop_back();
+  level.worlds.pop_back();
+  level.slots.pop_back();
+  slot.denseIndex = InvalidIndex;
+  slot.dirty = false;
+
+  while (!m_levels.empty() && m_levels.back().slots.empty())
+    m_levels.pop_back();
+  return local;
+}
+
+void TransformHierarchy::Link(uint32_t slotIndex, uint32_t parent)
+{
+  Slot & slot = m_slots[slotIndex];
+  slot.parent = parent;
+  slot.prevSibling = InvalidIndex;
+  slot.nextSibling = InvalidIndex;
+  if (parent == InvalidIndex)
+    return;
+
+  Slot & parentSlot = m_slots[parent];
+  slot.nextSibling = parentSlot.firstChild;
+  if (parentSlot.firstChild != InvalidIndex)
+    m_slots[parentSlot.firstChild].prevSibling = slotIndex;
+  parentSlot.firstChild = slotIndex;
+}
+
+void TransformHierarchy::Unlink(uint32_t slotIndex)
+{
+  Slot & slot = m_slots[slotIndex];
+  if (slot.prevSibling != InvalidIndex)
+    m_slots[slot.prevSibling].nextSibling = slot.nextSibling;
+  else if (slot.parent != InvalidIndex)
+    m_slots[slot.parent].firstChild = slot.nextSibling;
+  if (slot.nextSibling != InvalidIndex)
+    m_slots[slot.nextSibling].prevSibling = slot.prevSibling;
+  slot.parent = InvalidIndex;
+  slot.prevSibling = InvalidIndex;
+  slot.nextSibling = InvalidIndex;
+}
+
+void TransformHierarchy::UpdateBatch(const Level * parentLevel, Level & level, size_t first,
+                                     size_t count)
+{
+  const auto parents = std::span(m_parentMatrices).subspan(first, count);
+  const auto results = std::span(m_resultMatrices).subspan(first, count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    const Slot & slot = m_slots[m_batch[first + i]];
+    results[i] = ToMatrix(level.locals[slot.denseIndex]);
+    if (parentLevel)
+      parents[i] = parentLevel->worlds[m_slots[slot.parent].denseIndex];
+  }
+  if (parentLevel)
+    MultiplyMatrices(parents, results, results);
+  for (size_t i = 0; i < count; ++i)
+    level.worlds[m_slots[m_batch[first + i]].denseIndex] = results[i];
+}
+
+} // namespace GameFramework
@@ -0,0 +1,114 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <Game/Math.hpp>
+
+namespace GameFramework
+{
+
+/// @brief handle of TransformHierarchy node, generation invalidates handles of destroyed nodes
+struct TransformHandle final
+{
+  uint32_t index = std::numeric_limits<uint32_t>::max();
+  uint32_t generation = 0;
+
+  constexpr bool IsValid() const noexcept
+  {
+    return index != std::numeric_limits<uint32_t>::max();
+  }
+  constexpr bool operator==(const TransformHandle & rhs) const noexcept = default;
+};
+
+/// @brief local transform relative to the parent, applied as scale, rotation, translation
+struct GAME_FRAMEWORK_API Transform final
+{
+  Vec3f translation;
+  Vec4f rotation{0.0f, 0.0f, 0.0f, 1.0f}; ///< unit quaternion (x, y, z, w)
+  Vec3f scale{1.0f, 1.0f, 1.0f};
+};
+
+/// @brief matrix of the transform, column-major as in GLM
+GAME_FRAMEWORK_API Mat4f ToMatrix(const Transform & transform) noexcept;
+
+/// @brief Tree of transforms. Nodes are stored by depth, so parents are always updated before
+///        children. Changed nodes are marked dirty and Update recomputes world matrices only for
+///        them and their subtrees, one depth level at a time with the nodes of the level spread
+///        over the thread pool. It isn't thread-safe, invalid handles are ignored
+class GAME_FRAMEWORK_API TransformHierarchy final
+{
+public:
+  /// @brief creates node as a root if parent is invalid
+  TransformHandle Create(const Transform & local, TransformHandle parent = {});
+  /// @brief destroys node with all its descendants
+  void Destroy(TransformHandle handle);
+  bool IsAlive(TransformHandle handle) const noexcept;
+
+  void SetLocal(TransformHandle handle, const Transform & local);
+  const Transform & GetLocal(TransformHandle handle) const noexcept;
+  /// @brief moves node with its subtree under new parent or makes it a root if parent is invalid
+  /// @return false if handle is invalid or parent is the node itself or its descendant,
+  ///         nothing is changed then
+  bool SetParent(TransformHandle handle, TransformHandle parent);
+  TransformHandle GetParent(TransformHandle handle) const noexcept;
+
+  /// @brief recomputes world matrices of changed subtrees
+  void Update();
+  /// @brief world matrix computed by the last Update, identity for invalid handles
+  const Mat4f & GetWorldMatrix(TransformHandle handle) const noexcept;
+
+  size_t GetSize() const noexcept { return m_size; }
+  size_t GetDepth() const noexcept { return m_levels.size(); }
+  /// @brief count of nodes recomputed by the last Update
+  size_t GetUpdatedCount() const noexcept { return m_updatedCount; }
+
+private:
+  static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+  /// @brief stable place of the node which handles point to
+  struct Slot final
+  {
+    uint32_t generation = 0;
+    uint32_t depth = 0;
+    uint32_t denseIndex = InvalidIndex; ///< InvalidIndex if slot is free
+    uint32_t parent = InvalidIndex;
+    uint32_t firstChild = InvalidIndex;
+    uint32_t prevSibling = InvalidIndex;
+    uint32_t nextSibling = InvalidIndex;
+    bool dirty = false;
+  };
+
+  /// @brief dense arrays of nodes with the same depth
+  struct Level final
+  {
+    std::vector<Transform> locals;
+    std::vector<Mat4f> worlds;
+    std::vector<uint32_t> slots;
+    std::vector<uint32_t> dirty; ///< slots to recompute, may contain stale entries
+  };
+
+  std::vector<Slot> m_slots;
+  std::vector<uint32_t> m_freeSlots;
+  std::vector<Level> m_levels;
+  std::vector<uint32_t> m_batch;        ///< dirty slots of the level being updated
+  std::vector<Mat4f> m_parentMatrices;  ///< world matrices of parents of the batch
+  std::vector<Mat4f> m_resultMatrices;  ///< local and then world matrices of the batch
+  size_t m_size = 0;
+  size_t m_updatedCount = 0;
+
+private:
+  const Slot * FindSlot(TransformHandle handle) const noexcept;
+  void MarkDirty(uint32_t slotIndex);
+  void Insert(uint32_t slotIndex, uint32_t depth, const Transform & local);
+  /// @brief removes node from dense arrays, slot and links are kept
+  Transform Extract(uint32_t slotIndex);
+  void Link(uint32_t slotIndex, uint32_t parent);
+  void Unlink(uint32_t slotIndex);
+  void UpdateBatch(const Level * parentLevel, Level & level, size_t first, size_t count);
+};
+
+} // namespace GameFramework
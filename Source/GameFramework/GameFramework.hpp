@@ -9,57 +9,17 @@
 
 #include <Assets/AssetsRegistry.hpp>
 #include <Files/FileManager.hpp>
+#include <Game/FramePacer.hpp>
+#include <Game/FrameTelemetry.hpp>
+#include <Game/MathBatch.hpp>
+#include <Game/ThreadPool.hpp>
+#include <Game/TransformHierarchy.hpp>
 #include <Input/InputController.hpp>
+#include <Input/InputPoller.hpp>
+#include <Input/InputRecorder.hpp>
 #include <PluginInterfaces/GamePlugin.hpp>
 #include <PluginInterfaces/RenderPlugin.hpp>
 #include <PluginInterfaces/WindowsPlugin.hpp>
-
-namespace GameFramework
-{
-
-enum class LogMessageType : uint8_t
-{
-  Info,
-  Warning,
-  Error,
-  Debug
-};
-
-namespace details
-{
-/// Log message during game is running
-GAME_FRAMEWORK_API void LogImpl(LogMessageType type, std::wstring && message);
-} // namespace details
-
-template<typename... Args>
-inline void Log(LogMessageType type, Args &&... args)
-{
-  thread_local std::wostringstream stream;
-  auto writeToStream = [](std::wostringstream & stream, auto && value)
-  {
-    using T = decltype(value);
-    if constexpr (std::is_same_v<std::decay_t<T>, std::string> ||
-                  std::is_same_v<std::decay_t<T>, std::string_view>)
-    {
-      // Convert std::string to std::wstring
-      stream << std::wstring(value.begin(), value.end());
-    }
-    else if constexpr (std::is_same_v<std::decay_t<T>, const char *>)
-    {
-      // Convert const char* to std::wstring
-      stream << std::wstring(value, value + std::strlen(value));
-    }
-    else
-    {
-      // Normal case (includes std::wstring, numbers, etc.)
-      stream << std::forward<T>(value);
-    }
-  };
-
-  stream.str(L"");
-  stream.clear();
-  (writeToStream(stream, std::forward<Args>(args)), ...);
-  details::LogImpl(type, stream.str());
-}
-
-} // namespace GameFramework
+#include <Utility/LogCategory.hpp>
+#include <Utility/Logger.hpp>
+#include <Utility/Profiler.hpp>
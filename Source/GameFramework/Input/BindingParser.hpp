@@ -1,7 +1,10 @@
 #pragma once
+#include <span>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
+#include <Input/Input.hpp>
 #include <Input/InputDevice.hpp>
 #include <Input/InputProcessor.hpp>
 
@@ -10,11 +13,26 @@ namespace GameFramework::details
 struct BindingParser final
 {
   BindingParser() = default;
+  /// @brief parse binding string at runtime, errors are logged
   explicit BindingParser(std::string_view str);
+  /// @brief take conditions parsed at compile time with ParseStaticBinding
+  explicit BindingParser(std::span<const BindingCondition> conditions);
   AxesCondition GetAxesResult(InputDevice device) const;
   ButtonsCondition GetButtonsResult(InputDevice device) const;
+  SequencesCondition GetSequencesResult(InputDevice device) const;
 
 private:
-  std::unordered_map<InputDevice, std::pair<AxesCondition, ButtonsCondition>> m_parsedBinding;
+  struct ParsedConditions final
+  {
+    AxesCondition axes;
+    ButtonsCondition buttons;
+    SequencesCondition sequences;
+  };
+
+  std::unordered_map<InputDevice, ParsedConditions> m_parsedBinding;
+
+private:
+  /// @param lastSequence - sequence which gets next steps of sequence
+  void AddCondition(const BindingCondition & condition, ButtonsSequence *& lastSequence);
 };
 } // namespace GameFramework::details
@@ -1,7 +1,10 @@
 #pragma once
 #include <GameFramework_def.h>
 
+#include <array>
+#include <span>
 #include <string>
+#include <utility>
 #include <variant>
 
 #include <Input/InputDevice.hpp>
@@ -49,12 +52,33 @@ struct AxisAction final
 
 using GameInputEvent = std::variant<EventAction, ContinousAction, AxisAction>;
 
+/// max count of buttons in one chord (KeyW+KeyX)
+constexpr size_t ChordButtonsLimit = 4;
+/// max count of steps in one sequence (KeyA > KeyB > KeyC)
+constexpr size_t SequenceStepsLimit = 8;
+
+/// @brief parsed condition of binding: superposition of axes or chord of buttons
+struct BindingCondition final
+{
+  InputDevice device = InputDevice::UNKNOWN;
+  bool isAxis = false;
+  std::array<InputAxis, AxesSuperpositionLimit> axes{InputAxis::UNKNOWN, InputAxis::UNKNOWN,
+                                                      InputAxis::UNKNOWN};
+  std::array<std::pair<InputButton, PressState>, ChordButtonsLimit> chord{};
+  size_t chordSize = 0;
+  bool isSequenceStep = false; ///< steps of sequence (KeyA > KeyB) are consecutive conditions
+  float holdTime = 0.0f;       ///< chord should be held for this time (seconds), KeyE(1s)
+  float maxDelay = 0.0f;       ///< max delay after previous step, 0 for the first step
+};
+
 struct InputBinding
 {
   std::string name;     ///< name of the action, can be "Jump", "MoveForward", etc
   int code = 0;         ///< code ID of the action, use enum to define it
   std::string bindings; ///< string to declare keys that represents this action
   ActionType type = ActionType::Event;
+  /// conditions parsed at compile time (see ParseStaticBinding), bindings string isn't parsed then
+  std::span<const BindingCondition> parsed;
 };
 
 } // namespace GameFramework
@@ -1,4 +1,6 @@
 #pragma once
+#include <span>
+
 #include <Input/InputDevice.hpp>
 
 namespace GameFramework
@@ -6,6 +8,15 @@ namespace GameFramework
 
 struct InputController;
 
+/// @brief change of button's state published by backend
+struct InputStateChange final
+{
+  double timestamp; ///< time of change, see TimeManager::Timestamp
+  InputDevice device;
+  InputButton button;
+  PressState state;
+};
+
 /// @brief provides low-level input events
 struct InputBackend
 {
@@ -28,6 +39,32 @@ struct InputBackend
   /// @return value of axis (if device is not connected or it hasn't so axis, return NAN)
   virtual AxisValue CheckAxisState(InputDevice device, InputAxis axis) const noexcept = 0;
 
+  /// @brief check state of a set of buttons on current device at once
+  /// @param states - output, has the same size as buttons
+  virtual void CheckButtonsState(InputDevice device, std::span<const InputButton> buttons,
+                                 std::span<PressState> states) const noexcept
+  {
+    for (size_t i = 0; i < buttons.size(); ++i)
+      states[i] = CheckButtonState(device, buttons[i]);
+  }
+
+  /// @brief check values of a set of axes on current device at once
+  /// @param values - output, has the same size as axes
+  virtual void CheckAxesState(InputDevice device, std::span<const InputAxis> axes,
+                              std::span<AxisValue> values) const noexcept
+  {
+    for (size_t i = 0; i < axes.size(); ++i)
+      values[i] = CheckAxisState(device, axes[i]);
+  }
+
+  /// @brief if true, backend publishes changes of device's buttons to controller
+  ///        (InputController::OnButtonStateChanged) and they aren't polled
+  virtual bool IsEventDriven(InputDevice device) const noexcept { return false; }
+
+  /// @brief if false, states of polled device are the same as on the previous frame,
+  ///        so reading of the device can be skipped
+  virtual bool HasDeviceChanged(InputDevice device) const noexcept { return true; }
+
   /// @brief get description of input device
   virtual InputDeviceDescription GetInputDeviceDescription(InputDevice device) const noexcept = 0;
 };
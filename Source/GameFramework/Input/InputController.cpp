@@ -10,7 +10,8 @@
 #include <Game/Time.hpp>
 #include <GameFramework.hpp>
 #include <Input/BindingParser.hpp>
-#include <Input/InputProcessor.hpp>
+#include <Utility/Profiler.hpp>
+#include <Input/InputEvaluator.hpp>
 #include <Input/InputQueue.hpp>
 #include <Utility/Utility.hpp>
 
@@ -31,7 +32,9 @@ struct InputBindingComparator final
   bool operator()(const GameFramework::InputBinding & b1,
                   const GameFramework::InputBinding & b2) const noexcept
   {
-    return b1.name == b2.name && b1.code == b2.code && b1.bindings == b2.bindings;
+    return b1.name == b2.name && b1.code == b2.code && b1.bindings == b2.bindings &&
+           b1.type == b2.type && b1.parsed.data() == b2.parsed.data() &&
+           b1.parsed.size() == b2.parsed.size();
   }
 };
 } // namespace
@@ -46,8 +49,11 @@ public:
   virtual ~InputControllerImpl();
 
   virtual void GenerateInputEvents() override;
+  virtual void GenerateChangeEvents() override;
+  virtual void GenerateStateEvents() override;
   virtual void SetInputBindings(const std::span<InputBinding> & bindings) override;
   virtual void OnNewInputDeviceConnected(InputDevice device, bool connected) override;
+  virtual void OnButtonStateChanged(const InputStateChange & change) override;
 
 private:
   InputBackend * m_backend = nullptr;
@@ -55,7 +61,12 @@ private:
   using ParsedBindingsMap = std::unordered_map<InputBinding, details::BindingParser,
                                                InputBindingHasher, InputBindingComparator>;
   ParsedBindingsMap m_bindings;
-  std::vector<details::InputProcessorUPtr> m_processors;
+  details::InputEvaluator m_evaluator;
+  std::vector<GameInputEvent> m_events; ///< events of the frame, reused between frames
+
+private:
+  /// @brief compile bindings for all connected devices
+  void RebuildEvaluator();
 };
 
 InputControllerImpl::InputControllerImpl(InputBackend & backend)
@@ -71,67 +82,77 @@ InputControllerImpl::~InputControllerImpl()
 
 void InputControllerImpl::GenerateInputEvents()
 {
-  double time = GetTimeManager().Now();
-  for (auto && processor : m_processors)
-  {
-    if (processor)
-    {
-      processor->TickAction(time);
-      auto event = processor->GetAction();
-      if (event.has_value())
-        PushInputEvent(*event);
-    }
-  }
+  PROFILE_FUNCTION();
+  m_events.clear();
+  // not cached time of frame, so it's correct on the polling thread too
+  m_evaluator.Evaluate(*m_backend, GetTimeManager().Timestamp(), m_events);
+  for (auto && event : m_events)
+    PushInputEvent(event);
+}
+
+void InputControllerImpl::GenerateChangeEvents()
+{
+  PROFILE_FUNCTION();
+  m_events.clear();
+  m_evaluator.Poll(*m_backend, GetTimeManager().Timestamp(), m_events);
+  for (auto && event : m_events)
+    PushInputEvent(event);
+}
+
+void InputControllerImpl::GenerateStateEvents()
+{
+  PROFILE_FUNCTION();
+  m_events.clear();
+  m_evaluator.EvaluateStates(GetTimeManager().Timestamp(), m_events);
+  for (auto && event : m_events)
+    PushInputEvent(event);
 }
 
 void InputControllerImpl::SetInputBindings(const std::span<InputBinding> & bindings)
 {
+  // unchanged bindings keep their parsed conditions, so reconfigure parses only new strings
+  ParsedBindingsMap oldBindings = std::move(m_bindings);
   m_bindings.clear();
   for (auto && binding : bindings)
   {
-    auto [it, inserted] = m_bindings.insert({binding, details::BindingParser()});
-    if (inserted)
-    {
-      it->second = details::BindingParser(binding.bindings);
-    }
+    if (m_bindings.contains(binding))
+      continue;
+    if (auto node = oldBindings.extract(binding))
+      m_bindings.insert(std::move(node));
+    else if (!binding.parsed.empty())
+      m_bindings.emplace(binding, details::BindingParser(binding.parsed));
+    else
+      m_bindings.emplace(binding, details::BindingParser(binding.bindings));
   }
-  m_processors.clear();
-  for (auto device : m_connectedDevices)
-    OnNewInputDeviceConnected(device, true);
+  RebuildEvaluator();
 }
 
 void InputControllerImpl::OnNewInputDeviceConnected(InputDevice device, bool connected)
 {
   if (connected)
-  {
-    auto [_, inserted] = m_connectedDevices.insert(device);
-
-    auto btnChecker = std::bind(&InputBackend::CheckButtonState, m_backend, std::placeholders::_1,
-                                std::placeholders::_2);
+    m_connectedDevices.insert(device);
+  else
+    m_connectedDevices.erase(device);
+  RebuildEvaluator();
+}
 
-    auto axisChecker = std::bind(&InputBackend::CheckAxisState, m_backend, std::placeholders::_1,
-                                 std::placeholders::_2);
+void InputControllerImpl::OnButtonStateChanged(const InputStateChange & change)
+{
+  m_evaluator.OnButtonChanged(change);
+}
 
+void InputControllerImpl::RebuildEvaluator()
+{
+  m_evaluator.Clear();
+  for (InputDevice device : m_connectedDevices)
+  {
     for (auto && [binding, parser] : m_bindings)
     {
-      m_processors.emplace_back(details::CreateAxisProcessor(binding.type, binding.code, device,
-                                                             parser.GetAxesResult(device),
-                                                             axisChecker));
-      m_processors.emplace_back(details::CreateButtonProcessor(binding.type, binding.code, device,
-                                                               parser.GetButtonsResult(device),
-                                                               btnChecker));
+      m_evaluator.AddAxisAction(binding.type, binding.code, device, parser.GetAxesResult(device));
+      m_evaluator.AddButtonAction(binding.type, binding.code, device,
+                                  parser.GetButtonsResult(device),
+                                  parser.GetSequencesResult(device));
     }
-
-    // remove nullptrs
-    auto it = std::remove(m_processors.begin(), m_processors.end(), nullptr);
-    m_processors.erase(it, m_processors.end());
-  }
-  else //!connected
-  {
-    m_connectedDevices.erase(device);
-    auto range = std::ranges::remove_if(m_processors, [device](auto && proc)
-                                        { return !proc || proc->GetDevice() == device; });
-    m_processors.erase(range.begin(), range.end());
   }
 }
 
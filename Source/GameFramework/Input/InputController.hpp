@@ -16,8 +16,16 @@ struct InputController : public InputProducer
 {
   virtual ~InputController() = default;
 
-  /// @brief generates input actions in game
+  /// @brief generates input actions in game. Controller should be used by one thread,
+  ///        the thread which polls its backend
   virtual void GenerateInputEvents() = 0;
+  /// @brief like GenerateInputEvents, but only events of buttons are generated.
+  ///        Continous and axis actions are accumulated until GenerateStateEvents,
+  ///        so input can be polled more often than frames without flooding the game
+  virtual void GenerateChangeEvents() = 0;
+  /// @brief generates continous and axis actions accumulated since the previous call.
+  ///        Backend isn't read, so it can be called by other thread if calls are serialized
+  virtual void GenerateStateEvents() = 0;
 
   /// @brief applies new input binding
   /// @param bindings - a set of bindings for actions
@@ -27,6 +35,10 @@ struct InputController : public InputProducer
   /// @param device - id of device
   /// @param connected - bool flag of connection state
   virtual void OnNewInputDeviceConnected(InputDevice device, bool connected) = 0;
+
+  /// @brief event on change of button's state, published by event-driven backends
+  /// @param change - device, button, new state and time of change
+  virtual void OnButtonStateChanged(const InputStateChange & change) = 0;
 };
 
 using InputControllerUPtr = std::unique_ptr<InputController>;
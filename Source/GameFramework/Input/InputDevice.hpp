@@ -1,7 +1,6 @@
 #pragma once
 
 #include <array>
-#include <functional>
 #include <optional>
 #include <string>
 
@@ -220,8 +219,12 @@ enum class InputAxis : int
   // mouse
   MOUSE_CURSOR_X,
   MOUSE_CURSOR_Y,
+  MOUSE_DELTA_X,  // motion accumulated since the previous poll, raw if cursor is hidden
+  MOUSE_DELTA_Y,
+  MOUSE_SCROLL_X, // scroll accumulated since the previous poll
+  MOUSE_SCROLL_Y,
   MOUSE_FIRST_AXIS = MOUSE_CURSOR_X,
-  MOUSE_LAST_AXIS = MOUSE_CURSOR_Y,
+  MOUSE_LAST_AXIS = MOUSE_SCROLL_Y,
 
   // gamepad axes
   GAMEPAD_LEFT_STICK_X,  // left stick x
@@ -290,14 +293,57 @@ struct InputDeviceDescription
   bool isGamepad = false;
 };
 
-using CheckAxisStateFunc = std::function<AxisValue(InputDevice, InputAxis)>;
-using CheckButtonStateFunc = std::function<PressState(InputDevice, InputButton)>;
-
 /// @brief get device by button id
-InputDevice GetDeviceByButton(InputButton button) noexcept;
+constexpr InputDevice GetDeviceByButton(InputButton button) noexcept
+{
+  if (button >= InputButton::MOUSE_BUTTON_1 && button <= InputButton::MOUSE_LAST_BUTTON)
+    return InputDevice::MOUSE;
+  if (button >= InputButton::KEY_SPACE && button <= InputButton::KEYBOARD_LAST_BUTTON)
+    return InputDevice::KEYBOARD;
+
+  if (button >= InputButton::GAMEPAD_BUTTON_A && button <= InputButton::GAMEPAD_LAST_BUTTON)
+    return InputDevice::ANY_JOYSTICK;
+  if (button >= InputButton::JOYSTICK_BUTTON_1 && button <= InputButton::JOYSTICK_LAST_BUTTON)
+    return InputDevice::ANY_JOYSTICK;
+
+  return InputDevice::UNKNOWN;
+}
 
 /// @brief get device by axis id
-InputDevice GetDeviceByAxis(InputAxis axis) noexcept;
+constexpr InputDevice GetDeviceByAxis(InputAxis axis) noexcept
+{
+  switch (axis)
+  {
+    case InputAxis::MOUSE_CURSOR_X:
+    case InputAxis::MOUSE_CURSOR_Y:
+    case InputAxis::MOUSE_DELTA_X:
+    case InputAxis::MOUSE_DELTA_Y:
+    case InputAxis::MOUSE_SCROLL_X:
+    case InputAxis::MOUSE_SCROLL_Y:
+      return InputDevice::MOUSE;
+    case InputAxis::GAMEPAD_LEFT_STICK_X:
+    case InputAxis::GAMEPAD_LEFT_STICK_Y:
+    case InputAxis::GAMEPAD_RIGHT_STICK_X:
+    case InputAxis::GAMEPAD_RIGHT_STICK_Y:
+    case InputAxis::GAMEPAD_LEFT_TRIGGER:
+    case InputAxis::GAMEPAD_RIGHT_TRIGGER:
+    case InputAxis::JOYSTICK_AXIS_1:
+    case InputAxis::JOYSTICK_AXIS_2:
+    case InputAxis::JOYSTICK_AXIS_3:
+    case InputAxis::JOYSTICK_AXIS_4:
+    case InputAxis::JOYSTICK_AXIS_5:
+    case InputAxis::JOYSTICK_AXIS_6:
+      return InputDevice::ANY_JOYSTICK;
+    default:
+      return InputDevice::UNKNOWN;
+  }
+}
+
+/// @brief value of relative axis is a change since the previous poll, not a position
+constexpr bool IsRelativeAxis(InputAxis axis) noexcept
+{
+  return axis >= InputAxis::MOUSE_DELTA_X && axis <= InputAxis::MOUSE_SCROLL_Y;
+}
 
 constexpr inline PressState operator|(PressState s1, PressState s2)
 {
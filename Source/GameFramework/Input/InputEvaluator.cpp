@@ -0,0 +1,571 @@
+#include "InputEvaluator.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace GameFramework::details
+{
+namespace
+{
+constexpr size_t BitsPerWord = 64;
+
+constexpr uint64_t MakeSlotKey(InputDevice device, int input) noexcept
+{
+  return (static_cast<uint64_t>(device) << 32) | static_cast<uint32_t>(input);
+}
+
+bool HasAxisValues(const AxesValue & values) noexcept
+{
+  return !std::ranges::all_of(values, IsAxisValueValid);
+}
+
+/// JUST_PRESSED or PRESSING, other bits are modifiers
+constexpr uint8_t PressBitsMask = 0b11;
+
+/// @brief pressed button satisfies any pressed state, because held key is repeated as PRESSING.
+///        Modifiers of the binding must be held, other ones (e.g. CapsLock) are ignored
+bool IsPressStateSatisfied(PressState actual, PressState required) noexcept
+{
+  const auto actualBits = static_cast<uint8_t>(actual);
+  const auto requiredBits = static_cast<uint8_t>(required);
+  const uint8_t requiredModifiers = requiredBits & ~PressBitsMask;
+  return ((actualBits & PressBitsMask) != 0) == ((requiredBits & PressBitsMask) != 0) &&
+         (actualBits & requiredModifiers) == requiredModifiers;
+}
+} // namespace
+
+template<typename InputT, typename StateT>
+uint32_t InputEvaluator::SlotsTable<InputT, StateT>::GetSlot(InputDevice device, InputT input)
+{
+  auto [it, inserted] =
+    index.try_emplace(MakeSlotKey(device, static_cast<int>(input)),
+                      static_cast<uint32_t>(inputs.size()));
+  if (!inserted)
+    return it->second;
+
+  // slots of one device are kept together to read them with one call
+  const auto size = static_cast<uint32_t>(inputs.size());
+  if (devices.empty() || devices.back().device != device || devices.back().last != size)
+    devices.push_back({device, size, size});
+  devices.back().last++;
+  inputs.push_back(input);
+  if constexpr (std::is_same_v<StateT, AxisValue>)
+    states.push_back(AxisNoValue);
+  else
+    states.push_back(StateT{});
+  return it->second;
+}
+
+template<typename InputT, typename StateT>
+uint32_t InputEvaluator::SlotsTable<InputT, StateT>::FindSlot(InputDevice device,
+                                                              InputT input) const noexcept
+{
+  auto it = index.find(MakeSlotKey(device, static_cast<int>(input)));
+  return it == index.end() ? NoIndex : it->second;
+}
+
+template<typename InputT, typename StateT>
+void InputEvaluator::SlotsTable<InputT, StateT>::Clear()
+{
+  devices.clear();
+  inputs.clear();
+  states.clear();
+  index.clear();
+}
+
+void InputEvaluator::Clear()
+{
+  m_buttons.Clear();
+  m_axes.Clear();
+  m_polledAxes.clear();
+  m_polledStates.clear();
+
+  m_predicateSlots.clear();
+  m_predicateStates.clear();
+  m_predicateBits.clear();
+  m_predicateActions.clear();
+  m_reverseIndexOutdated = true;
+  m_snapshotOutdated = true;
+
+  m_chordWords.clear();
+  m_chordMasks.clear();
+
+  m_btnActionChords.clear();
+  m_btnActionSequences.assign(1, 0);
+  m_btnActionTypes.clear();
+  m_btnActionCodes.clear();
+  m_btnActionDevices.clear();
+  m_btnActive.clear();
+  m_btnReported.clear();
+  m_btnActiveTimestamps.clear();
+  m_activeContinousActions.clear();
+  m_pendingEvents.clear();
+
+  m_stepChords.clear();
+  m_stepHoldTimes.clear();
+  m_stepMaxDelays.clear();
+
+  m_sequenceSteps.assign(1, 0);
+  m_seqActions.clear();
+  m_seqStep.clear();
+  m_seqPressed.clear();
+  m_seqActive.clear();
+  m_seqHolding.clear();
+  m_seqPressedAt.clear();
+  m_seqLastStepAt.clear();
+  m_holdingSequences.clear();
+  m_checkedHolds.clear();
+
+  m_superpositions.clear();
+  m_axisActionSuperpositions.assign(1, 0);
+  m_axisActionCodes.clear();
+  m_axisActionDevices.clear();
+  m_axisOldValues.clear();
+  m_axisCurValues.clear();
+}
+
+uint32_t InputEvaluator::AddChord(InputDevice device, const ButtonsChord & chord,
+                                  uint32_t action)
+{
+  assert(!chord.empty() && chord.size() <= BitsPerWord);
+  // chord never crosses the word, so it's checked with one mask.
+  // Padding predicates repeat the first button of the chord and aren't masked
+  const uint32_t firstSlot = m_buttons.GetSlot(device, chord.front().first);
+  if (m_predicateSlots.size() % BitsPerWord + chord.size() > BitsPerWord)
+  {
+    const size_t padded = (m_predicateSlots.size() / BitsPerWord + 1) * BitsPerWord;
+    m_predicateSlots.resize(padded, firstSlot);
+    m_predicateStates.resize(padded, PressState::RELEASED);
+    m_predicateActions.resize(padded, NoIndex);
+  }
+
+  const size_t firstBit = m_predicateSlots.size() % BitsPerWord;
+  m_chordWords.push_back(static_cast<uint32_t>(m_predicateSlots.size() / BitsPerWord));
+  m_chordMasks.push_back(
+    (chord.size() == BitsPerWord ? ~uint64_t{0} : (uint64_t{1} << chord.size()) - 1) << firstBit);
+  for (auto && [button, state] : chord)
+  {
+    m_predicateSlots.push_back(m_buttons.GetSlot(device, button));
+    m_predicateStates.push_back(state);
+    m_predicateActions.push_back(action);
+  }
+  return static_cast<uint32_t>(m_chordWords.size() - 1);
+}
+
+void InputEvaluator::AddButtonAction(ActionType actionType, int actionCode, InputDevice device,
+                                     const ButtonsCondition & condition,
+                                     const SequencesCondition & sequences)
+{
+  if (actionType != ActionType::Event && actionType != ActionType::Continous)
+    return;
+
+  const auto action = static_cast<uint32_t>(m_btnActionCodes.size());
+  const size_t chordsCount = m_chordWords.size();
+  const size_t sequencesCount = m_seqActions.size();
+  // chords of action are added first, because they're contiguous range
+  for (auto && chord : condition)
+  {
+    if (!chord.empty())
+      AddChord(device, chord, action);
+  }
+  const auto actionChordsEnd = static_cast<uint32_t>(m_chordWords.size());
+
+  for (auto && sequence : sequences)
+  {
+    auto isEmptyStep = [](const SequenceStep & step) { return step.chord.empty(); };
+    if (sequence.empty() || std::ranges::any_of(sequence, isEmptyStep))
+      continue;
+    for (auto && step : sequence)
+    {
+      m_stepChords.push_back(AddChord(device, step.chord, action));
+      m_stepHoldTimes.push_back(step.holdTime);
+      m_stepMaxDelays.push_back(step.maxDelay);
+    }
+    m_sequenceSteps.push_back(static_cast<uint32_t>(m_stepChords.size()));
+    m_seqActions.push_back(action);
+    m_seqStep.push_back(0);
+    m_seqPressed.push_back(0);
+    m_seqActive.push_back(0);
+    m_seqHolding.push_back(0);
+    m_seqPressedAt.push_back(0.0);
+    m_seqLastStepAt.push_back(0.0);
+  }
+  if (m_chordWords.size() == chordsCount && m_seqActions.size() == sequencesCount)
+    return; // there are no conditions
+
+  m_btnActionChords.emplace_back(static_cast<uint32_t>(chordsCount), actionChordsEnd);
+  m_btnActionSequences.push_back(static_cast<uint32_t>(m_seqActions.size()));
+  m_btnActionTypes.push_back(actionType);
+  m_btnActionCodes.push_back(actionCode);
+  m_btnActionDevices.push_back(device);
+  m_btnActive.push_back(0);
+  m_btnReported.push_back(0);
+  m_btnActiveTimestamps.push_back(0.0);
+
+  m_predicateBits.resize((m_predicateSlots.size() + BitsPerWord - 1) / BitsPerWord);
+  m_polledStates.resize(m_buttons.states.size());
+  m_reverseIndexOutdated = true;
+  m_snapshotOutdated = true;
+}
+
+void InputEvaluator::AddAxisAction(ActionType actionType, int actionCode, InputDevice device,
+                                   const AxesCondition & condition)
+{
+  if (condition.empty() || actionType != ActionType::Axis)
+    return;
+
+  for (auto && superposition : condition)
+  {
+    SuperpositionSlots slots;
+    slots.fill(NoIndex);
+    for (size_t i = 0; i < superposition.size() && superposition[i] != InputAxis::UNKNOWN; ++i)
+      slots[i] = m_axes.GetSlot(device, superposition[i]);
+    m_superpositions.push_back(slots);
+  }
+  m_axisActionSuperpositions.push_back(static_cast<uint32_t>(m_superpositions.size()));
+  m_axisActionCodes.push_back(actionCode);
+  m_axisActionDevices.push_back(device);
+  m_axisOldValues.push_back({AxisNoValue, AxisNoValue, AxisNoValue});
+  m_axisCurValues.push_back({AxisNoValue, AxisNoValue, AxisNoValue});
+  m_polledAxes.resize(m_axes.states.size());
+  m_snapshotOutdated = true;
+}
+
+void InputEvaluator::OnButtonChanged(const InputStateChange & change)
+{
+  const uint32_t slot = m_buttons.FindSlot(change.device, change.button);
+  if (slot != NoIndex)
+    SetButtonState(slot, change.state, change.timestamp);
+}
+
+void InputEvaluator::Evaluate(const InputBackend & backend, double currentTime,
+                              std::vector<GameInputEvent> & events)
+{
+  Poll(backend, currentTime, events);
+  EvaluateStates(currentTime, events);
+}
+
+void InputEvaluator::Poll(const InputBackend & backend, double currentTime,
+                          std::vector<GameInputEvent> & events)
+{
+  ReadSnapshot(backend, currentTime);
+  UpdateHolds(currentTime);
+  events.insert(events.end(), m_pendingEvents.begin(), m_pendingEvents.end());
+  m_pendingEvents.clear();
+}
+
+void InputEvaluator::EvaluateStates(double currentTime, std::vector<GameInputEvent> & events)
+{
+  EvaluateContinousActions(currentTime, events);
+  EvaluateAxisActions(events);
+}
+
+void InputEvaluator::BuildReverseIndex()
+{
+  const size_t slotsCount = m_buttons.inputs.size();
+  const size_t predicatesCount = m_predicateSlots.size();
+  m_slotPredicatesOffsets.assign(slotsCount + 1, 0);
+  m_slotActionsOffsets.assign(slotsCount + 1, 0);
+
+  // unique pairs (slot, action)
+  std::vector<std::pair<uint32_t, uint32_t>> slotActions;
+  slotActions.reserve(predicatesCount);
+  for (size_t i = 0; i < predicatesCount; ++i)
+  {
+    if (m_predicateActions[i] == NoIndex)
+      continue;
+    m_slotPredicatesOffsets[m_predicateSlots[i] + 1]++;
+    slotActions.emplace_back(m_predicateSlots[i], m_predicateActions[i]);
+  }
+  std::ranges::sort(slotActions);
+  const auto duplicates = std::ranges::unique(slotActions);
+  slotActions.erase(duplicates.begin(), duplicates.end());
+
+  for (size_t i = 0; i < slotsCount; ++i)
+    m_slotPredicatesOffsets[i + 1] += m_slotPredicatesOffsets[i];
+  m_slotPredicates.resize(m_slotPredicatesOffsets.back());
+  std::vector<uint32_t> cursors(m_slotPredicatesOffsets.begin(),
+                                m_slotPredicatesOffsets.end() - 1);
+  for (size_t i = 0; i < predicatesCount; ++i)
+  {
+    if (m_predicateActions[i] != NoIndex)
+      m_slotPredicates[cursors[m_predicateSlots[i]]++] = static_cast<uint32_t>(i);
+  }
+
+  m_slotActions.clear();
+  for (auto && [slot, action] : slotActions)
+  {
+    m_slotActionsOffsets[slot + 1]++;
+    m_slotActions.push_back(action);
+  }
+  for (size_t i = 0; i < slotsCount; ++i)
+    m_slotActionsOffsets[i + 1] += m_slotActionsOffsets[i];
+
+  // predicates are calculated once here, then only changes update them
+  std::ranges::fill(m_predicateBits, 0);
+  for (size_t i = 0; i < predicatesCount; ++i)
+  {
+    const uint64_t satisfied =
+      IsPressStateSatisfied(m_buttons.states[m_predicateSlots[i]], m_predicateStates[i]);
+    m_predicateBits[i / BitsPerWord] |= satisfied << (i % BitsPerWord);
+  }
+  m_reverseIndexOutdated = false;
+}
+
+void InputEvaluator::ReadSnapshot(const InputBackend & backend, double currentTime)
+{
+  if (m_reverseIndexOutdated)
+    BuildReverseIndex();
+
+  // new slots are read even if their device isn't changed or is event-driven,
+  // otherwise buttons held while bindings were changed stay released until the next event
+  const bool readAll = std::exchange(m_snapshotOutdated, false);
+  for (auto && [device, first, last] : m_buttons.devices)
+  {
+    if (!readAll && (backend.IsEventDriven(device) || !backend.HasDeviceChanged(device)))
+      continue;
+    const auto polled = std::span(m_polledStates).subspan(first, last - first);
+    backend.CheckButtonsState(device, std::span(m_buttons.inputs).subspan(first, last - first),
+                              polled);
+    for (uint32_t slot = first; slot < last; ++slot)
+    {
+      if (m_polledStates[slot] != m_buttons.states[slot])
+        SetButtonState(slot, m_polledStates[slot], currentTime);
+    }
+  }
+  for (auto && [device, first, last] : m_axes.devices)
+  {
+    // unchanged device hasn't accumulated any motion since the previous poll
+    if (!readAll && !backend.HasDeviceChanged(device))
+      continue;
+    backend.CheckAxesState(device, std::span(m_axes.inputs).subspan(first, last - first),
+                           std::span(m_polledAxes).subspan(first, last - first));
+    for (uint32_t slot = first; slot < last; ++slot)
+    {
+      // backend accumulates motion of one poll, several polls are summed until report
+      AxisValue & state = m_axes.states[slot];
+      if (IsRelativeAxis(m_axes.inputs[slot]) && m_polledAxes[slot] != AxisNoValue)
+        state = (state != AxisNoValue ? state : 0.0f) + m_polledAxes[slot];
+      else
+        state = m_polledAxes[slot];
+    }
+  }
+}
+
+void InputEvaluator::SetButtonState(uint32_t slot, PressState state, double timestamp)
+{
+  if (m_reverseIndexOutdated)
+    BuildReverseIndex();
+
+  m_buttons.states[slot] = state;
+  for (uint32_t i = m_slotPredicatesOffsets[slot]; i < m_slotPredicatesOffsets[slot + 1]; ++i)
+  {
+    const uint32_t predicate = m_slotPredicates[i];
+    const uint64_t bit = uint64_t{1} << (predicate % BitsPerWord);
+    const uint64_t satisfied = IsPressStateSatisfied(state, m_predicateStates[predicate]) ? bit : 0;
+    uint64_t & word = m_predicateBits[predicate / BitsPerWord];
+    word = (word & ~bit) | satisfied;
+  }
+  for (uint32_t i = m_slotActionsOffsets[slot]; i < m_slotActionsOffsets[slot + 1]; ++i)
+    UpdateButtonAction(m_slotActions[i], timestamp);
+}
+
+bool InputEvaluator::IsChordPressed(uint32_t chord) const noexcept
+{
+  return (m_predicateBits[m_chordWords[chord]] & m_chordMasks[chord]) == m_chordMasks[chord];
+}
+
+bool InputEvaluator::IsButtonActionActive(uint32_t action) const noexcept
+{
+  bool isActive = false;
+  auto [firstChord, chordsEnd] = m_btnActionChords[action];
+  for (uint32_t c = firstChord; c < chordsEnd; ++c)
+    isActive |= IsChordPressed(c);
+  for (uint32_t s = m_btnActionSequences[action]; s < m_btnActionSequences[action + 1]; ++s)
+    isActive |= m_seqActive[s] != 0;
+  return isActive;
+}
+
+void InputEvaluator::UpdateButtonAction(uint32_t action, double timestamp)
+{
+  for (uint32_t s = m_btnActionSequences[action]; s < m_btnActionSequences[action + 1]; ++s)
+    UpdateSequence(s, timestamp);
+
+  const bool isActive = IsButtonActionActive(action);
+  if (isActive == (m_btnActive[action] != 0))
+    return;
+
+  m_btnActive[action] = isActive;
+  const bool isContinous = m_btnActionTypes[action] == ActionType::Continous;
+  if (isActive)
+  {
+    m_btnActiveTimestamps[action] = timestamp;
+    m_btnReported[action] = 0;
+    if (isContinous)
+      m_activeContinousActions.push_back(action);
+    else
+      m_pendingEvents.emplace_back(
+        EventAction{m_btnActionCodes[action], m_btnActionDevices[action]});
+  }
+  else if (isContinous)
+  {
+    std::erase(m_activeContinousActions, action);
+    // it was pressed and released between frames, so it's reported once
+    if (!m_btnReported[action])
+    {
+      const double start = m_btnActiveTimestamps[action];
+      m_pendingEvents.emplace_back(ContinousAction{m_btnActionCodes[action],
+                                                   m_btnActionDevices[action], start,
+                                                   std::max(0.0, timestamp - start)});
+    }
+  }
+}
+
+void InputEvaluator::UpdateSequence(uint32_t sequence, double timestamp)
+{
+  const uint32_t firstStep = m_sequenceSteps[sequence];
+  const uint32_t lastStep = m_sequenceSteps[sequence + 1] - 1;
+  if (m_seqActive[sequence])
+  {
+    // sequence is active while the chord of the last step is held
+    if (!IsChordPressed(m_stepChords[lastStep]))
+      ResetSequence(sequence);
+    return;
+  }
+
+  uint32_t step = firstStep + m_seqStep[sequence];
+  const bool isPressed = IsChordPressed(m_stepChords[step]);
+  const bool wasPressed = std::exchange(m_seqPressed[sequence], isPressed) != 0;
+  if (isPressed == wasPressed || !isPressed)
+    return; // only press of awaited chord moves the sequence, release breaks the hold
+
+  if (step != firstStep && timestamp - m_seqLastStepAt[sequence] > m_stepMaxDelays[step])
+  {
+    // too late for the next step, so this press can only start the sequence again
+    ResetSequence(sequence);
+    step = firstStep;
+    if (!m_seqPressed[sequence])
+      return;
+  }
+
+  m_seqPressedAt[sequence] = timestamp;
+  if (m_stepHoldTimes[step] > 0.0f)
+  {
+    if (!std::exchange(m_seqHolding[sequence], 1))
+      m_holdingSequences.push_back(sequence);
+    return;
+  }
+  CompleteSequenceStep(sequence, timestamp);
+}
+
+void InputEvaluator::CompleteSequenceStep(uint32_t sequence, double timestamp)
+{
+  m_seqLastStepAt[sequence] = timestamp;
+  const uint32_t firstStep = m_sequenceSteps[sequence];
+  const uint32_t stepsCount = m_sequenceSteps[sequence + 1] - firstStep;
+  if (m_seqStep[sequence] + 1 == stepsCount)
+  {
+    m_seqActive[sequence] = 1;
+    return;
+  }
+  // the next step needs a new press, chord which is already held doesn't count
+  const uint32_t next = ++m_seqStep[sequence];
+  m_seqPressed[sequence] = IsChordPressed(m_stepChords[firstStep + next]);
+}
+
+void InputEvaluator::ResetSequence(uint32_t sequence)
+{
+  m_seqStep[sequence] = 0;
+  m_seqActive[sequence] = 0;
+  m_seqPressed[sequence] = IsChordPressed(m_stepChords[m_sequenceSteps[sequence]]);
+}
+
+void InputEvaluator::UpdateHolds(double currentTime)
+{
+  // completed holds update actions, which might start new holds
+  std::swap(m_holdingSequences, m_checkedHolds);
+  m_holdingSequences.clear();
+  for (uint32_t sequence : m_checkedHolds)
+  {
+    const uint32_t step = m_sequenceSteps[sequence] + m_seqStep[sequence];
+    const double doneAt = m_seqPressedAt[sequence] + m_stepHoldTimes[step];
+    if (!m_seqPressed[sequence] || m_seqActive[sequence])
+    {
+      m_seqHolding[sequence] = 0; // hold is broken
+    }
+    else if (currentTime < doneAt)
+    {
+      m_holdingSequences.push_back(sequence);
+    }
+    else
+    {
+      m_seqHolding[sequence] = 0;
+      CompleteSequenceStep(sequence, doneAt);
+      UpdateButtonAction(m_seqActions[sequence], doneAt);
+    }
+  }
+  m_checkedHolds.clear();
+}
+
+void InputEvaluator::EvaluateContinousActions(double currentTime,
+                                              std::vector<GameInputEvent> & events)
+{
+  // continous actions are fired every frame while they're active
+  for (uint32_t a : m_activeContinousActions)
+  {
+    const double start = m_btnActiveTimestamps[a];
+    m_btnReported[a] = 1;
+    events.emplace_back(ContinousAction{m_btnActionCodes[a], m_btnActionDevices[a], start,
+                                        std::max(0.0, currentTime - start)});
+  }
+}
+
+void InputEvaluator::EvaluateAxisActions(std::vector<GameInputEvent> & events)
+{
+  const size_t actionsCount = m_axisActionCodes.size();
+  for (size_t a = 0; a < actionsCount; ++a)
+  {
+    AxesValue & cur = m_axisCurValues[a];
+    AxesValue & old = m_axisOldValues[a];
+    std::array<bool, AxesSuperpositionLimit> isRelative{};
+    bool onlyRelative = true;
+    for (uint32_t s = m_axisActionSuperpositions[a]; s < m_axisActionSuperpositions[a + 1]; ++s)
+    {
+      const SuperpositionSlots & slots = m_superpositions[s];
+      for (size_t i = 0; i < AxesSuperpositionLimit && slots[i] != NoIndex; ++i)
+      {
+        old[i] = std::exchange(cur[i], m_axes.states[slots[i]]);
+        isRelative[i] = IsRelativeAxis(m_axes.inputs[slots[i]]);
+        onlyRelative &= isRelative[i];
+      }
+    }
+
+    if (!HasAxisValues(cur))
+      continue;
+    // relative axes are accumulated by backend, so their value is the delta itself.
+    // Action is skipped if all its axes are relative and there was no motion
+    bool hasMotion = false;
+    AxesValue delta = {0.0f};
+    const bool hasOld = HasAxisValues(old);
+    for (size_t i = 0; i < AxesSuperpositionLimit; ++i)
+    {
+      if (isRelative[i])
+        delta[i] = cur[i];
+      else if (hasOld)
+        delta[i] = cur[i] - old[i];
+      hasMotion |= isRelative[i] && cur[i] != 0.0f;
+    }
+    if (onlyRelative && !hasMotion)
+      continue;
+    events.emplace_back(AxisAction{m_axisActionCodes[a], m_axisActionDevices[a], cur, delta});
+  }
+
+  // accumulated motion is reported, slots are shared by actions, so they're reset after all
+  for (size_t slot = 0; slot < m_axes.inputs.size(); ++slot)
+  {
+    if (IsRelativeAxis(m_axes.inputs[slot]) && m_axes.states[slot] != AxisNoValue)
+      m_axes.states[slot] = 0.0f;
+  }
+}
+
+} // namespace GameFramework::details
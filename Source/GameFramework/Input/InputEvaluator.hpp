@@ -0,0 +1,171 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Input/Input.hpp>
+#include <Input/InputBackend.hpp>
+#include <Input/InputDevice.hpp>
+#include <Input/InputProcessor.hpp>
+
+namespace GameFramework::details
+{
+
+/*
+* Evaluates all bindings of all connected devices in one pass.
+* Bindings are compiled into flat arrays:
+*   slots      - unique (device, button) or (device, axis) pairs, their state is read once per frame
+*   predicates - (slot, required state), results are packed into 64-bit words
+*   chords     - mask of predicates in one word, chord is active if all its bits are set
+*   actions    - range of chords (or axes superpositions) and state of the action
+*   sequences  - steps (chord, hold time, max delay after previous step) and a state machine
+* Buttons are evaluated incrementally: a change of the slot updates its predicates and
+* re-evaluates actions which use the slot (reverse index slot -> predicates, actions) with
+* the timestamp of the change, so inputs between frames aren't lost. Fired events are kept
+* until Evaluate. Besides changes, a frame only checks running holds and active continous
+* actions, so idle frames cost nothing.
+* Changes can be polled more often than frames: Poll writes only events of buttons, while
+* continous actions and motion of relative axes are accumulated until EvaluateStates.
+* Changes come from backend (OnButtonChanged) or from the diff of polled snapshot for devices
+* which don't publish changes. Snapshot is requested per device, without per-button calls,
+* and devices which report that they aren't changed are skipped
+*/
+class InputEvaluator final
+{
+public:
+  InputEvaluator() = default;
+
+  void Clear();
+  /// @brief compile button binding of device. Ignores actions which aren't Event or Continous
+  void AddButtonAction(ActionType actionType, int actionCode, InputDevice device,
+                       const ButtonsCondition & condition, const SequencesCondition & sequences);
+  /// @brief compile axis binding of device. Ignores actions which aren't Axis
+  void AddAxisAction(ActionType actionType, int actionCode, InputDevice device,
+                     const AxesCondition & condition);
+
+  /// @brief apply change of button published by backend
+  void OnButtonChanged(const InputStateChange & change);
+
+  /// @brief Poll and EvaluateStates at once
+  void Evaluate(const InputBackend & backend, double currentTime,
+                std::vector<GameInputEvent> & events);
+  /// @brief polls devices which don't publish changes, updates actions and writes fired events
+  ///        of buttons
+  void Poll(const InputBackend & backend, double currentTime,
+            std::vector<GameInputEvent> & events);
+  /// @brief writes active continous actions and axis actions with motion accumulated since
+  ///        the previous call. Backend isn't read
+  void EvaluateStates(double currentTime, std::vector<GameInputEvent> & events);
+
+  size_t GetActionsCount() const noexcept
+  {
+    return m_btnActionCodes.size() + m_axisActionCodes.size();
+  }
+
+private:
+  static constexpr uint32_t NoIndex = ~uint32_t{0};
+
+  /// range of slots from one device which is read by one backend call
+  struct DeviceSlots final
+  {
+    InputDevice device;
+    uint32_t first;
+    uint32_t last;
+  };
+
+  template<typename InputT, typename StateT>
+  struct SlotsTable final
+  {
+    std::vector<DeviceSlots> devices;
+    std::vector<InputT> inputs;
+    std::vector<StateT> states;
+    std::unordered_map<uint64_t, uint32_t> index; ///< (device, input) -> slot
+
+    uint32_t GetSlot(InputDevice device, InputT input);
+    uint32_t FindSlot(InputDevice device, InputT input) const noexcept;
+    void Clear();
+  };
+
+  SlotsTable<InputButton, PressState> m_buttons;
+  SlotsTable<InputAxis, AxisValue> m_axes; ///< relative axes accumulate motion between reports
+  std::vector<AxisValue> m_polledAxes;
+
+  std::vector<PressState> m_polledStates; ///< snapshot of devices which don't publish changes
+  bool m_snapshotOutdated = true;         ///< slots were added, so all devices must be read
+
+  // predicates
+  std::vector<uint32_t> m_predicateSlots;
+  std::vector<PressState> m_predicateStates;
+  std::vector<uint64_t> m_predicateBits;
+  std::vector<uint32_t> m_predicateActions; ///< NoIndex for padding predicates
+
+  // reverse index, offsets have an extra element at the end
+  bool m_reverseIndexOutdated = true;
+  std::vector<uint32_t> m_slotPredicatesOffsets;
+  std::vector<uint32_t> m_slotPredicates;
+  std::vector<uint32_t> m_slotActionsOffsets;
+  std::vector<uint32_t> m_slotActions;
+
+  // chords
+  std::vector<uint32_t> m_chordWords;
+  std::vector<uint64_t> m_chordMasks;
+
+  // button actions
+  /// range of action's own chords, chords of sequence steps are placed after it
+  std::vector<std::pair<uint32_t, uint32_t>> m_btnActionChords;
+  std::vector<uint32_t> m_btnActionSequences{0}; ///< first sequence of action
+  std::vector<ActionType> m_btnActionTypes;
+  std::vector<int> m_btnActionCodes;
+  std::vector<InputDevice> m_btnActionDevices;
+  std::vector<uint8_t> m_btnActive;
+  std::vector<uint8_t> m_btnReported; ///< continous action has been reported at least once
+  std::vector<double> m_btnActiveTimestamps;
+  std::vector<uint32_t> m_activeContinousActions;
+  std::vector<GameInputEvent> m_pendingEvents; ///< events fired by changes since last Evaluate
+
+  // steps of sequences
+  std::vector<uint32_t> m_stepChords;
+  std::vector<float> m_stepHoldTimes;
+  std::vector<float> m_stepMaxDelays;
+
+  // sequences' state machines
+  std::vector<uint32_t> m_sequenceSteps{0}; ///< first step of sequence
+  std::vector<uint32_t> m_seqActions;
+  std::vector<uint32_t> m_seqStep;      ///< index of awaited step in sequence
+  std::vector<uint8_t> m_seqPressed;    ///< chord of awaited step is pressed
+  std::vector<uint8_t> m_seqActive;     ///< all steps are done and the last chord is held
+  std::vector<uint8_t> m_seqHolding;    ///< sequence is in m_holdingSequences
+  std::vector<double> m_seqPressedAt;   ///< time when chord of awaited step was pressed
+  std::vector<double> m_seqLastStepAt;  ///< time when previous step was done
+  std::vector<uint32_t> m_holdingSequences;
+  std::vector<uint32_t> m_checkedHolds;
+
+  // axis actions
+  using SuperpositionSlots = std::array<uint32_t, AxesSuperpositionLimit>;
+  std::vector<SuperpositionSlots> m_superpositions;
+  std::vector<uint32_t> m_axisActionSuperpositions{0}; ///< first superposition of action
+  std::vector<int> m_axisActionCodes;
+  std::vector<InputDevice> m_axisActionDevices;
+  std::vector<AxesValue> m_axisOldValues;
+  std::vector<AxesValue> m_axisCurValues;
+
+private:
+  void BuildReverseIndex();
+  void ReadSnapshot(const InputBackend & backend, double currentTime);
+  void SetButtonState(uint32_t slot, PressState state, double timestamp);
+  uint32_t AddChord(InputDevice device, const ButtonsChord & chord, uint32_t action);
+  bool IsChordPressed(uint32_t chord) const noexcept;
+  bool IsButtonActionActive(uint32_t action) const noexcept;
+  void UpdateButtonAction(uint32_t action, double timestamp);
+  void UpdateSequence(uint32_t sequence, double timestamp);
+  void CompleteSequenceStep(uint32_t sequence, double timestamp);
+  void ResetSequence(uint32_t sequence);
+  void UpdateHolds(double currentTime);
+  void EvaluateContinousActions(double currentTime, std::vector<GameInputEvent> & events);
+  void EvaluateAxisActions(std::vector<GameInputEvent> & events);
+};
+
+} // namespace GameFramework::details
@@ -0,0 +1,75 @@
+#include "InputPoller.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include <Utility/Profiler.hpp>
+
+namespace GameFramework
+{
+
+InputPoller::InputPoller(WindowsPlugin & windows, double pollingRate) noexcept
+  : m_windows(windows)
+  , m_period(std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(1.0 / std::max(pollingRate, 1.0))))
+{
+}
+
+void InputPoller::AddController(InputController & controller)
+{
+  m_controllers.push_back(&controller);
+}
+
+void InputPoller::SetInputBindings(std::vector<InputBinding> && bindings)
+{
+  std::lock_guard lk{m_bindingsMutex};
+  m_pendingBindings = std::move(bindings);
+}
+
+void InputPoller::Run(const std::function<bool()> & shouldStop)
+{
+  while (!m_stop.load(std::memory_order_relaxed) && !shouldStop())
+    Poll();
+}
+
+void InputPoller::Poll()
+{
+  PROFILE_FUNCTION();
+  // backend changes controllers from callbacks of windows, so lock is held while waiting
+  std::lock_guard controllersLock{m_controllersMutex};
+  std::optional<std::vector<InputBinding>> bindings;
+  {
+    std::lock_guard lk{m_bindingsMutex};
+    bindings.swap(m_pendingBindings);
+  }
+  if (bindings)
+  {
+    for (auto * controller : m_controllers)
+      controller->SetInputBindings(*bindings);
+  }
+
+  const auto now = Clock::now();
+  if (now < m_nextPoll)
+  {
+    m_windows.WaitEvents(std::chrono::duration<double>(m_nextPoll - now).count());
+  }
+  else
+  {
+    m_windows.PollEvents();
+    // if polling was late, don't try to catch up with several polls at once
+    m_nextPoll = (now - m_nextPoll > m_period) ? now + m_period : m_nextPoll + m_period;
+  }
+
+  for (auto * controller : m_controllers)
+    controller->GenerateChangeEvents();
+}
+
+void InputPoller::GenerateFrameEvents()
+{
+  PROFILE_FUNCTION();
+  std::lock_guard lk{m_controllersMutex};
+  for (auto * controller : m_controllers)
+    controller->GenerateStateEvents();
+}
+
+} // namespace GameFramework
@@ -0,0 +1,61 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <Input/Input.hpp>
+#include <Input/InputController.hpp>
+#include <PluginInterfaces/WindowsPlugin.hpp>
+
+namespace GameFramework
+{
+
+/// @brief polls events of windows and generates events of buttons at fixed rate,
+///        independently of frame rate. It runs on the thread which owns windows (the main thread
+///        for GLFW), the game runs on another thread and consumes events from InputQueue.
+///        Continous and axis actions are generated by the game thread once per frame
+class GAME_FRAMEWORK_API InputPoller final
+{
+  using Clock = std::chrono::steady_clock;
+
+public:
+  /// @param pollingRate - polls per second
+  InputPoller(WindowsPlugin & windows, double pollingRate) noexcept;
+
+  /// @brief controller is used only by the polling thread after it's added
+  void AddController(InputController & controller);
+
+  /// @brief can be called from any thread, bindings are applied before the next poll
+  void SetInputBindings(std::vector<InputBinding> && bindings);
+
+  /// @brief polls until shouldStop returns true or Stop is called
+  void Run(const std::function<bool()> & shouldStop);
+  /// @brief can be called from any thread
+  void Stop() noexcept { m_stop.store(true, std::memory_order_relaxed); }
+
+  /// @brief waits for events of windows until the next poll and generates events of buttons.
+  ///        Events of keyboard and mouse wake it up earlier, so they aren't delayed
+  void Poll();
+
+  /// @brief called by the game thread once per frame, generates continous and axis actions
+  ///        accumulated by polls. Waits for the running poll, one polling period at most
+  void GenerateFrameEvents();
+
+private:
+  WindowsPlugin & m_windows;
+  Clock::duration m_period;
+  Clock::time_point m_nextPoll = Clock::now();
+  std::vector<InputController *> m_controllers;
+  std::mutex m_controllersMutex; ///< controllers are used by polling and game threads
+  std::atomic<bool> m_stop = false;
+
+  std::mutex m_bindingsMutex; ///< guards m_pendingBindings
+  std::optional<std::vector<InputBinding>> m_pendingBindings;
+};
+
+} // namespace GameFramework
@@ -1,7 +1,6 @@
 #pragma once
-#include <functional>
-#include <memory>
-#include <optional>
+#include <array>
+#include <vector>
 
 #include <Input/Input.hpp>
 #include <Input/InputDevice.hpp>
@@ -28,25 +27,19 @@ using ButtonsChord = std::vector<ButtonPressState>;
 ///         for example: Go forward is W or Up or
 using ButtonsCondition = std::vector<ButtonsChord>;
 
-/// @brief watches on one ActionEvent
-struct InputProcessor
+/// @brief step of sequence: chord which should be pressed (and held for holdTime)
+///        not later than maxDelay after previous step
+struct SequenceStep final
 {
-  virtual ~InputProcessor() = default;
-  /// @brief updates state of processor and generate actions if need it
-  /// @param currentTime
-  virtual void TickAction(double currentTime) = 0;
-  /// @brief get generated action if it's active
-  virtual std::optional<GameInputEvent> GetAction() const noexcept = 0;
-  /// @brief get device to be listened
-  /// @return id of device
-  virtual InputDevice GetDevice() const noexcept = 0;
+  ButtonsChord chord;
+  float holdTime = 0.0f;
+  float maxDelay = 0.0f;
 };
 
-using InputProcessorUPtr = std::unique_ptr<InputProcessor>;
+/// @brief steps which should be done one after another, for example: Ctrl > S(1s)
+///        Single chord with hold time is a sequence of one step
+using ButtonsSequence = std::vector<SequenceStep>;
 
-InputProcessorUPtr CreateButtonProcessor(ActionType actionType, int actionCode, InputDevice device,
-                                         ButtonsCondition condition,
-                                         CheckButtonStateFunc checkButtonState);
-InputProcessorUPtr CreateAxisProcessor(ActionType actionType, int actionCode, InputDevice device,
-                                       AxesCondition condition, CheckAxisStateFunc checkAxisState);
+/// @brief sequences which activate the action
+using SequencesCondition = std::vector<ButtonsSequence>;
 } // namespace GameFramework::details
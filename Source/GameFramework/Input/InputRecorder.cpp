@@ -0,0 +1,299 @@
+#include "InputRecorder.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <Game/Time.hpp>
+#include <Utility/Logger.hpp>
+
+namespace GameFramework
+{
+namespace
+{
+/*
+* File format, values are stored as they're in memory:
+*   header - magic "GFIR", uint32 version
+*   frame  - double now, double delta, uint32 count of events, events
+*   event  - uint8 index of GameInputEvent alternative, int32 code, uint32 device, then
+*            ContinousAction: double activeStart, double activeDuration
+*            AxisAction: float[3] axisValue, float[3] deltaValue
+*/
+constexpr std::array<char, 4> s_magic{'G', 'F', 'I', 'R'};
+constexpr uint32_t s_version = 1;
+/// recorded frames are written to the file by chunks of this size
+constexpr size_t s_flushThreshold = 64 * 1024;
+/// event without payload: index, code and device
+constexpr size_t s_minEventSize = sizeof(uint8_t) + sizeof(int32_t) + sizeof(uint32_t);
+
+template<typename T>
+void Write(std::vector<std::byte> & buffer, const T & value)
+{
+  static_assert(std::is_trivially_copyable_v<T>);
+  const size_t offset = buffer.size();
+  buffer.resize(offset + sizeof(T));
+  std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+/// reads values from loaded file, fails if there is not enough data
+struct Reader final
+{
+  const std::vector<std::byte> & data;
+  size_t offset = 0;
+
+  template<typename T>
+  bool Read(T & value) noexcept
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (data.size() - offset < sizeof(T))
+      return false;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+  }
+
+  size_t GetRemainingSize() const noexcept { return data.size() - offset; }
+};
+
+void WriteEvent(std::vector<std::byte> & buffer, const GameInputEvent & event)
+{
+  Write(buffer, static_cast<uint8_t>(event.index()));
+  std::visit(
+    [&buffer](auto && action)
+    {
+      using ActionT = std::decay_t<decltype(action)>;
+      Write(buffer, static_cast<int32_t>(action.code));
+      Write(buffer, static_cast<uint32_t>(action.device));
+      if constexpr (std::is_same_v<ActionT, ContinousAction>)
+      {
+        Write(buffer, action.activeStart);
+        Write(buffer, action.activeDuration);
+      }
+      else if constexpr (std::is_same_v<ActionT, AxisAction>)
+      {
+        Write(buffer, action.axisValue);
+        Write(buffer, action.deltaValue);
+      }
+    },
+    event);
+}
+
+template<typename ActionT>
+bool ReadAction(Reader & reader, ActionT & action) noexcept
+{
+  int32_t code;
+  uint32_t device;
+  if (!reader.Read(code) || !reader.Read(device))
+    return false;
+  action.code = code;
+  action.device = static_cast<InputDevice>(device);
+  if constexpr (std::is_same_v<ActionT, ContinousAction>)
+    return reader.Read(action.activeStart) && reader.Read(action.activeDuration);
+  else if constexpr (std::is_same_v<ActionT, AxisAction>)
+    return reader.Read(action.axisValue) && reader.Read(action.deltaValue);
+  return true;
+}
+
+bool ReadEvent(Reader & reader, GameInputEvent & event) noexcept
+{
+  uint8_t index;
+  if (!reader.Read(index))
+    return false;
+  switch (index)
+  {
+    case 0:
+      return ReadAction(reader, event.emplace<EventAction>());
+    case 1:
+      return ReadAction(reader, event.emplace<ContinousAction>());
+    case 2:
+      return ReadAction(reader, event.emplace<AxisAction>());
+  }
+  return false;
+}
+
+class FileInputRecorder final : public InputRecorder
+{
+public:
+  explicit FileInputRecorder(const std::filesystem::path & path)
+    : m_file(path, std::ios::binary | std::ios::trunc)
+  {
+    if (!m_file)
+      throw std::runtime_error("Failed to open input recording - " + path.string());
+    m_buffer.reserve(s_flushThreshold * 2);
+    Write(m_buffer, s_magic);
+    Write(m_buffer, s_version);
+  }
+
+  virtual ~FileInputRecorder() override { Flush(); }
+
+  virtual InputQueue & GetQueue() noexcept override { return m_queue; }
+
+  virtual void RecordFrame(double now, double delta) override
+  {
+    m_events.clear();
+    while (auto event = m_queue.PopEvent())
+      m_events.push_back(*event);
+
+    Write(m_buffer, now);
+    Write(m_buffer, delta);
+    Write(m_buffer, static_cast<uint32_t>(m_events.size()));
+    for (auto && event : m_events)
+      WriteEvent(m_buffer, event);
+    if (m_buffer.size() >= s_flushThreshold)
+      Flush();
+  }
+
+private:
+  std::ofstream m_file;
+  InputQueue m_queue;
+  std::vector<GameInputEvent> m_events; ///< events of the frame, reused between frames
+  std::vector<std::byte> m_buffer;      ///< encoded frames which aren't written yet
+
+private:
+  void Flush()
+  {
+    m_file.write(reinterpret_cast<const char *>(m_buffer.data()),
+                 static_cast<std::streamsize>(m_buffer.size()));
+    m_file.flush();
+    m_buffer.clear();
+  }
+};
+
+class InputReplayControllerImpl final : public InputReplayController
+{
+public:
+  InputReplayControllerImpl(const std::filesystem::path & path, double speed);
+
+  virtual void GenerateInputEvents() override;
+  /// frames are played whole, so there is nothing to split
+  virtual void GenerateChangeEvents() override { GenerateInputEvents(); }
+  virtual void GenerateStateEvents() override {}
+  virtual void SetInputBindings(const std::span<InputBinding> &) override {}
+  virtual void OnNewInputDeviceConnected(InputDevice, bool) override {}
+  virtual void OnButtonStateChanged(const InputStateChange &) override {}
+
+  virtual bool IsFinished() const noexcept override { return m_finished; }
+  virtual double GetFrameTime() const noexcept override { return m_frameTime; }
+  virtual double GetFrameDelta() const noexcept override { return m_frameDelta; }
+
+private:
+  std::vector<std::byte> m_data;
+  Reader m_reader{m_data};
+  const double m_speed;
+  bool m_finished = false;
+  bool m_started = false;
+  double m_replayStart = 0.0;   ///< time of the first GenerateInputEvents
+  double m_recordStart = 0.0;   ///< recorded time of the first frame
+  double m_nextFrameTime = 0.0; ///< recorded time of the frame which isn't played yet
+  double m_frameTime = 0.0;
+  double m_frameDelta = 0.0;    ///< sum of deltas of frames played by GenerateInputEvents
+  std::vector<GameInputEvent> m_events; ///< events of the played frame
+
+private:
+  /// @brief reads time of the next frame, marks replay as finished if there are no frames
+  bool PeekNextFrame();
+  void PlayNextFrame();
+};
+
+InputReplayControllerImpl::InputReplayControllerImpl(const std::filesystem::path & path,
+                                                     double speed)
+  : m_speed(speed)
+{
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+    throw std::runtime_error("Failed to open input recording - " + path.string());
+  file.seekg(0, std::ios::end);
+  m_data.resize(static_cast<size_t>(file.tellg()));
+  file.seekg(0, std::ios::beg);
+  file.read(reinterpret_cast<char *>(m_data.data()), static_cast<std::streamsize>(m_data.size()));
+
+  std::array<char, 4> magic;
+  uint32_t version;
+  if (!m_reader.Read(magic) || magic != s_magic || !m_reader.Read(version) ||
+      version != s_version)
+    throw std::runtime_error("Unsupported input recording - " + path.string());
+  if (PeekNextFrame())
+    m_recordStart = m_nextFrameTime;
+}
+
+bool InputReplayControllerImpl::PeekNextFrame()
+{
+  Reader peek = m_reader;
+  m_finished = !peek.Read(m_nextFrameTime);
+  return !m_finished;
+}
+
+void InputReplayControllerImpl::GenerateInputEvents()
+{
+  m_frameDelta = 0.0;
+  if (m_speed <= 0.0)
+  {
+    if (!m_finished)
+      PlayNextFrame();
+    return;
+  }
+
+  const double now = GetTimeManager().Now();
+  if (!std::exchange(m_started, true))
+    m_replayStart = now;
+  // frames are played when their recorded time comes, several frames might be played at once
+  const double recordTime = m_recordStart + (now - m_replayStart) * m_speed;
+  while (!m_finished && m_nextFrameTime <= recordTime)
+    PlayNextFrame();
+}
+
+void InputReplayControllerImpl::PlayNextFrame()
+{
+  double frameTime = 0.0;
+  double frameDelta = 0.0;
+  uint32_t eventsCount = 0;
+  if (!m_reader.Read(frameTime) || !m_reader.Read(frameDelta) || !m_reader.Read(eventsCount))
+  {
+    Log(LogMessageType::Warning, "Input recording is truncated, replay is finished");
+    m_finished = true;
+    return;
+  }
+  // count is checked before allocation, so corrupted file can't request huge buffer
+  if (eventsCount > m_reader.GetRemainingSize() / s_minEventSize)
+  {
+    Log(LogMessageType::Warning, "Input recording is corrupted, replay is finished");
+    m_finished = true;
+    return;
+  }
+  // frame is pushed only if it's read completely
+  m_events.resize(eventsCount);
+  for (auto && event : m_events)
+  {
+    if (!ReadEvent(m_reader, event))
+    {
+      Log(LogMessageType::Warning, "Input recording is truncated, replay is finished");
+      m_finished = true;
+      return;
+    }
+  }
+  for (auto && event : m_events)
+    PushInputEvent(event);
+  m_frameTime = frameTime;
+  m_frameDelta += frameDelta;
+  PeekNextFrame();
+}
+
+} // namespace
+
+GAME_FRAMEWORK_API InputRecorderUPtr CreateInputRecorder(const std::filesystem::path & path)
+{
+  return std::make_unique<FileInputRecorder>(path);
+}
+
+GAME_FRAMEWORK_API InputReplayControllerUPtr
+CreateInputReplayController(const std::filesystem::path & path, double speed)
+{
+  return std::make_unique<InputReplayControllerImpl>(path, speed);
+}
+
+} // namespace GameFramework
@@ -0,0 +1,56 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <filesystem>
+#include <memory>
+
+#include <Input/InputController.hpp>
+#include <Input/InputQueue.hpp>
+
+namespace GameFramework
+{
+
+/// @brief writes stream of input events and frame timing to binary file.
+///        Its queue is bound to controllers in addition to the game's queue
+struct InputRecorder
+{
+  virtual ~InputRecorder() = default;
+
+  /// @brief queue which collects events of the recorded controllers
+  virtual InputQueue & GetQueue() noexcept = 0;
+
+  /// @brief writes events pushed since the previous frame together with the frame's timing
+  /// @param now, delta - time of the frame, usually GetTimeManager().Now() and Delta()
+  virtual void RecordFrame(double now, double delta) = 0;
+};
+
+using InputRecorderUPtr = std::unique_ptr<InputRecorder>;
+
+/// @brief throws std::runtime_error if the file can't be opened
+GAME_FRAMEWORK_API InputRecorderUPtr CreateInputRecorder(const std::filesystem::path & path);
+
+
+/// @brief pushes recorded events frame by frame instead of evaluating bindings of some backend,
+///        so the game can be replayed without window. Bindings and devices are ignored
+struct InputReplayController : public InputController
+{
+  virtual ~InputReplayController() = default;
+
+  /// @brief all recorded frames are played
+  virtual bool IsFinished() const noexcept = 0;
+  /// @brief recorded time of the last played frame
+  virtual double GetFrameTime() const noexcept = 0;
+  /// @brief sum of recorded deltas of frames played by the last GenerateInputEvents (0 if none),
+  ///        use it to tick the game deterministically
+  virtual double GetFrameDelta() const noexcept = 0;
+};
+
+using InputReplayControllerUPtr = std::unique_ptr<InputReplayController>;
+
+/// @brief loads recording, throws std::runtime_error if the file can't be read
+/// @param speed - playback speed relative to the recorded time (GetTimeManager().Now() is used),
+///                0 plays one recorded frame per GenerateInputEvents as fast as it's called
+GAME_FRAMEWORK_API InputReplayControllerUPtr
+CreateInputReplayController(const std::filesystem::path & path, double speed = 1.0);
+
+} // namespace GameFramework
@@ -0,0 +1,523 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+#include <Input/Input.hpp>
+#include <Input/InputDevice.hpp>
+#include <Utility/Logger.hpp>
+#include <Utility/StaticString.hpp>
+#include <Utility/StringUtils.hpp>
+
+namespace GameFramework
+{
+namespace details
+{
+/// all binding are delimited with ;
+inline constexpr char s_delimiter = ';';
+inline constexpr char s_addButton = '+';
+inline constexpr char s_modButton = '&';
+inline constexpr char s_nextButton = '>';
+inline constexpr char s_holdBegin = '(';
+inline constexpr char s_holdEnd = ')';
+/// max delay between steps of sequence for every '>' between them, so KeyA >> KeyB allows 1s
+inline constexpr float s_sequenceStepTimeout = 0.5f;
+
+template<typename T, size_t N>
+using NamesTable = std::array<std::pair<std::string_view, T>, N>;
+
+/// sorts table at compile time, so names are looked up with binary search
+template<typename T, size_t N>
+constexpr NamesTable<T, N> SortByName(const std::pair<std::string_view, T> (&names)[N])
+{
+  NamesTable<T, N> result = std::to_array(names);
+  std::sort(result.begin(), result.end(),
+            [](auto && a, auto && b) { return a.first < b.first; });
+  return result;
+}
+
+template<typename T, size_t N>
+constexpr std::optional<T> FindByName(const NamesTable<T, N> & names,
+                                      std::string_view name) noexcept
+{
+  auto it = std::lower_bound(names.begin(), names.end(), name,
+                             [](auto && entry, std::string_view key) { return entry.first < key; });
+  if (it == names.end() || it->first != name)
+    return std::nullopt;
+  return it->second;
+}
+
+inline constexpr std::pair<std::string_view, InputAxis> s_axesNames[] = {
+  // Mouse
+  {"MouseCursorX", InputAxis::MOUSE_CURSOR_X},
+  {"MouseCursorY", InputAxis::MOUSE_CURSOR_Y},
+  {"MouseDeltaX", InputAxis::MOUSE_DELTA_X},
+  {"MouseDeltaY", InputAxis::MOUSE_DELTA_Y},
+  {"MouseScrollX", InputAxis::MOUSE_SCROLL_X},
+  {"MouseScrollY", InputAxis::MOUSE_SCROLL_Y},
+  {"GamepadLeftStickX", InputAxis::GAMEPAD_LEFT_STICK_X},
+  {"GamepadLeftStickY", InputAxis::GAMEPAD_LEFT_STICK_Y},
+  {"GamepadRightStickX", InputAxis::GAMEPAD_RIGHT_STICK_X},
+  {"GamepadRightStickY", InputAxis::GAMEPAD_RIGHT_STICK_Y},
+  {"GamepadL2", InputAxis::GAMEPAD_LEFT_TRIGGER},
+  {"GamepadR2", InputAxis::GAMEPAD_RIGHT_TRIGGER},
+};
+
+inline constexpr std::pair<std::string_view, InputButton> s_buttonsNames[] = {
+  // Mouse buttons
+  {"MouseButton1", InputButton::MOUSE_BUTTON_1},
+  {"MouseButton2", InputButton::MOUSE_BUTTON_2},
+  {"MouseButton3", InputButton::MOUSE_BUTTON_3},
+  {"MouseButton4", InputButton::MOUSE_BUTTON_4},
+  {"MouseButton5", InputButton::MOUSE_BUTTON_5},
+  {"MouseButton6", InputButton::MOUSE_BUTTON_6},
+  {"MouseButton7", InputButton::MOUSE_BUTTON_7},
+  {"MouseButton8", InputButton::MOUSE_BUTTON_8},
+  {"MouseButtonLeft", InputButton::MOUSE_BUTTON_LEFT},
+  {"MouseButtonRight", InputButton::MOUSE_BUTTON_RIGHT},
+  {"MouseButtonMiddle", InputButton::MOUSE_BUTTON_MIDDLE},
+
+  // Gamepad buttons
+  {"GamepadA", InputButton::GAMEPAD_BUTTON_A},
+  {"GamepadB", InputButton::GAMEPAD_BUTTON_B},
+  {"GamepadX", InputButton::GAMEPAD_BUTTON_X},
+  {"GamepadY", InputButton::GAMEPAD_BUTTON_Y},
+  {"GamepadL1", InputButton::GAMEPAD_BUTTON_LEFT_BUMPER},
+  {"GamepadR1", InputButton::GAMEPAD_BUTTON_RIGHT_BUMPER},
+  {"GamepadBack", InputButton::GAMEPAD_BUTTON_BACK},
+  {"GamepadStart", InputButton::GAMEPAD_BUTTON_START},
+  {"GamepadGuide", InputButton::GAMEPAD_BUTTON_GUIDE},
+  {"GamepadL3", InputButton::GAMEPAD_BUTTON_LEFT_THUMB},
+  {"GamepadR3", InputButton::GAMEPAD_BUTTON_RIGHT_THUMB},
+  {"GamepadDpadUp", InputButton::GAMEPAD_BUTTON_DPAD_UP},
+  {"GamepadDpadRight", InputButton::GAMEPAD_BUTTON_DPAD_RIGHT},
+  {"GamepadDpadDown", InputButton::GAMEPAD_BUTTON_DPAD_DOWN},
+  {"GamepadDpadLeft", InputButton::GAMEPAD_BUTTON_DPAD_LEFT},
+
+  // Keyboard letters
+  {"KeyA", InputButton::KEY_A},
+  {"KeyB", InputButton::KEY_B},
+  {"KeyC", InputButton::KEY_C},
+  {"KeyD", InputButton::KEY_D},
+  {"KeyE", InputButton::KEY_E},
+  {"KeyF", InputButton::KEY_F},
+  {"KeyG", InputButton::KEY_G},
+  {"KeyH", InputButton::KEY_H},
+  {"KeyI", InputButton::KEY_I},
+  {"KeyJ", InputButton::KEY_J},
+  {"KeyK", InputButton::KEY_K},
+  {"KeyL", InputButton::KEY_L},
+  {"KeyM", InputButton::KEY_M},
+  {"KeyN", InputButton::KEY_N},
+  {"KeyO", InputButton::KEY_O},
+  {"KeyP", InputButton::KEY_P},
+  {"KeyQ", InputButton::KEY_Q},
+  {"KeyR", InputButton::KEY_R},
+  {"KeyS", InputButton::KEY_S},
+  {"KeyT", InputButton::KEY_T},
+  {"KeyU", InputButton::KEY_U},
+  {"KeyV", InputButton::KEY_V},
+  {"KeyW", InputButton::KEY_W},
+  {"KeyX", InputButton::KEY_X},
+  {"KeyY", InputButton::KEY_Y},
+  {"KeyZ", InputButton::KEY_Z},
+
+  // Keyboard digits
+  {"Key0", InputButton::KEY_0},
+  {"Key1", InputButton::KEY_1},
+  {"Key2", InputButton::KEY_2},
+  {"Key3", InputButton::KEY_3},
+  {"Key4", InputButton::KEY_4},
+  {"Key5", InputButton::KEY_5},
+  {"Key6", InputButton::KEY_6},
+  {"Key7", InputButton::KEY_7},
+  {"Key8", InputButton::KEY_8},
+  {"Key9", InputButton::KEY_9},
+
+  // Function keys
+  {"KeyF1", InputButton::KEY_F1},
+  {"KeyF2", InputButton::KEY_F2},
+  {"KeyF3", InputButton::KEY_F3},
+  {"KeyF4", InputButton::KEY_F4},
+  {"KeyF5", InputButton::KEY_F5},
+  {"KeyF6", InputButton::KEY_F6},
+  {"KeyF7", InputButton::KEY_F7},
+  {"KeyF8", InputButton::KEY_F8},
+  {"KeyF9", InputButton::KEY_F9},
+  {"KeyF10", InputButton::KEY_F10},
+  {"KeyF11", InputButton::KEY_F11},
+  {"KeyF12", InputButton::KEY_F12},
+
+  // Special keys
+  {"KeySpace", InputButton::KEY_SPACE},
+  {"KeyEnter", InputButton::KEY_ENTER},
+  {"KeyEscape", InputButton::KEY_ESCAPE},
+  {"KeyTab", InputButton::KEY_TAB},
+  {"KeyBackspace", InputButton::KEY_BACKSPACE},
+  {"KeyInsert", InputButton::KEY_INSERT},
+  {"KeyDelete", InputButton::KEY_DELETE},
+  {"KeyHome", InputButton::KEY_HOME},
+  {"KeyEnd", InputButton::KEY_END},
+  {"KeyPageUp", InputButton::KEY_PAGE_UP},
+  {"KeyPageDown", InputButton::KEY_PAGE_DOWN},
+
+  // Arrow keys
+  {"KeyLeft", InputButton::KEY_LEFT},
+  {"KeyRight", InputButton::KEY_RIGHT},
+  {"KeyUp", InputButton::KEY_UP},
+  {"KeyDown", InputButton::KEY_DOWN},
+
+  // Modifier keys
+  {"KeyLeftShift", InputButton::KEY_LEFT_SHIFT},
+  {"KeyRightShift", InputButton::KEY_RIGHT_SHIFT},
+  {"KeyLeftCtrl", InputButton::KEY_LEFT_CONTROL},
+  {"KeyRightCtrl", InputButton::KEY_RIGHT_CONTROL},
+  {"KeyLeftAlt", InputButton::KEY_LEFT_ALT},
+  {"KeyRightAlt", InputButton::KEY_RIGHT_ALT},
+  {"KeyLeftSuper", InputButton::KEY_LEFT_SUPER},
+  {"KeyRightSuper", InputButton::KEY_RIGHT_SUPER},
+
+  // Keypad
+  {"KeyNumpad0", InputButton::KEY_KP_0},
+  {"KeyNumpad1", InputButton::KEY_KP_1},
+  {"KeyNumpad2", InputButton::KEY_KP_2},
+  {"KeyNumpad3", InputButton::KEY_KP_3},
+  {"KeyNumpad4", InputButton::KEY_KP_4},
+  {"KeyNumpad5", InputButton::KEY_KP_5},
+  {"KeyNumpad6", InputButton::KEY_KP_6},
+  {"KeyNumpad7", InputButton::KEY_KP_7},
+  {"KeyNumpad8", InputButton::KEY_KP_8},
+  {"KeyNumpad9", InputButton::KEY_KP_9},
+  {"KeyNumpadAdd", InputButton::KEY_KP_ADD},
+  {"KeyNumpadSubtract", InputButton::KEY_KP_SUBTRACT},
+  {"KeyNumpadMultiply", InputButton::KEY_KP_MULTIPLY},
+  {"KeyNumpadDivide", InputButton::KEY_KP_DIVIDE},
+  {"KeyNumpadDecimal", InputButton::KEY_KP_DECIMAL},
+  {"KeyNumpadEnter", InputButton::KEY_KP_ENTER},
+  {"KeyNumpadEqual", InputButton::KEY_KP_EQUAL},
+};
+
+inline constexpr std::pair<std::string_view, PressState> s_modifiersNames[] = {
+  {"Shift", PressState::SHIFT},        {"Alt", PressState::ALT},
+  {"Ctrl", PressState::CTRL},          {"Super", PressState::SUPER},
+  {"CapsLock", PressState::CAPS_LOCK}, {"NumLock", PressState::NUM_LOCK},
+};
+
+inline constexpr auto s_sortedAxesNames = SortByName(s_axesNames);
+inline constexpr auto s_sortedButtonsNames = SortByName(s_buttonsNames);
+inline constexpr auto s_sortedModifiersNames = SortByName(s_modifiersNames);
+
+/// calls func for every part of the string between delimiters
+template<typename FuncT>
+constexpr void ForEachToken(std::string_view str, char delimiter, FuncT && func)
+{
+  while (true)
+  {
+    const size_t end = str.find(delimiter);
+    func(str.substr(0, end));
+    if (end == std::string_view::npos)
+      return;
+    str.remove_prefix(end + 1);
+  }
+}
+
+/// @brief tries to parse superposition of axes, like MouseCursorX+MouseCursorY
+/// @return false if there are no known axes
+template<typename OnErrorT>
+constexpr bool ParseAxesCondition(std::string_view str, BindingCondition & result,
+                                  OnErrorT && onError)
+{
+  if (str.empty())
+  {
+    onError(LogMessageType::Error, "Expected axis's superposition", str);
+    return false;
+  }
+  size_t count = 0;
+  ForEachToken(str, s_addButton,
+               [&](std::string_view axisStr)
+               {
+                 if (axisStr.empty())
+                 {
+                   onError(LogMessageType::Error, "Expected axis's name", str);
+                   return;
+                 }
+                 const auto axis = FindByName(s_sortedAxesNames, Utils::Trim(axisStr));
+                 if (!axis)
+                   return;
+                 const InputDevice device = GetDeviceByAxis(*axis);
+                 if (result.device == InputDevice::UNKNOWN)
+                   result.device = device;
+                 if (result.device != device)
+                   onError(LogMessageType::Error, "Expected that all axes will be from one device",
+                           str);
+                 else if (count == AxesSuperpositionLimit)
+                   onError(LogMessageType::Error, "Too many axes in superposition", str);
+                 else
+                   result.axes[count++] = *axis;
+               });
+  result.isAxis = true;
+  return count > 0;
+}
+
+/// @brief parses button with modifiers, like KeyA&Shift&Ctrl
+template<typename OnErrorT>
+constexpr void ParseButtonPressState(std::string_view str, InputButton & button, PressState & state,
+                                     OnErrorT && onError)
+{
+  button = InputButton::UNKNOWN;
+  state = PressState::JUST_PRESSED;
+  if (str.empty())
+  {
+    onError(LogMessageType::Error, "Expected button or modifier", str);
+    return;
+  }
+  ForEachToken(str, s_modButton,
+               [&](std::string_view btnOrMod)
+               {
+                 btnOrMod = Utils::Trim(btnOrMod);
+                 if (button == InputButton::UNKNOWN)
+                 {
+                   if (auto btn = FindByName(s_sortedButtonsNames, btnOrMod))
+                   {
+                     button = *btn;
+                     return;
+                   }
+                 }
+                 if (auto mod = FindByName(s_sortedModifiersNames, btnOrMod))
+                   state = state | *mod;
+                 else
+                   onError(LogMessageType::Warning, "Unknown button or mod", str);
+               });
+}
+
+/// @brief tries to parse chord of buttons, like KeyW+KeyX
+/// @return false if there are no known buttons
+template<typename OnErrorT>
+constexpr bool ParseChordCondition(std::string_view str, BindingCondition & result,
+                                   OnErrorT && onError)
+{
+  if (str.empty())
+  {
+    onError(LogMessageType::Error, "Expected button's chord", str);
+    return false;
+  }
+  ForEachToken(str, s_addButton,
+               [&](std::string_view btnAndModStr)
+               {
+                 InputButton button;
+                 PressState state;
+                 ParseButtonPressState(btnAndModStr, button, state, onError);
+                 if (button == InputButton::UNKNOWN)
+                   return;
+                 const InputDevice device = GetDeviceByButton(button);
+                 if (result.device == InputDevice::UNKNOWN)
+                   result.device = device; // first parsed device is a device for a whole chord
+                 if (result.device != device)
+                   onError(LogMessageType::Error,
+                           "Expected that all buttons in chord will be from one device", str);
+                 else if (result.chordSize == ChordButtonsLimit)
+                   onError(LogMessageType::Error, "Too many buttons in chord", str);
+                 else
+                   result.chord[result.chordSize++] = {button, state};
+               });
+  return result.device != InputDevice::UNKNOWN && result.chordSize > 0;
+}
+
+/// @brief parses duration of hold, like 1s, 0.5s, 200ms
+template<typename OnErrorT>
+constexpr float ParseDuration(std::string_view str, OnErrorT && onError)
+{
+  str = Utils::Trim(str);
+  float scale = 1.0f;
+  if (str.ends_with("ms"))
+  {
+    scale = 0.001f;
+    str.remove_suffix(2);
+  }
+  else if (str.ends_with('s'))
+  {
+    str.remove_suffix(1);
+  }
+  else
+  {
+    onError(LogMessageType::Error, "Expected duration in s or ms", str);
+    return 0.0f;
+  }
+
+  float value = 0.0f;
+  float fraction = 0.0f;
+  bool hasDigits = false;
+  for (char c : str)
+  {
+    if (c >= '0' && c <= '9')
+    {
+      hasDigits = true;
+      if (fraction > 0.0f)
+      {
+        value += static_cast<float>(c - '0') * fraction;
+        fraction *= 0.1f;
+      }
+      else
+      {
+        value = value * 10.0f + static_cast<float>(c - '0');
+      }
+    }
+    else if (c == '.' && fraction == 0.0f)
+    {
+      fraction = 0.1f;
+    }
+    else
+    {
+      hasDigits = false;
+      break;
+    }
+  }
+  if (!hasDigits)
+    onError(LogMessageType::Error, "Expected duration in s or ms", str);
+  return value * scale;
+}
+
+/// @brief parses chord with optional hold time, like KeyE(1s)
+/// @return false if there are no known buttons
+template<typename OnErrorT>
+constexpr bool ParseTimedChordCondition(std::string_view str, BindingCondition & result,
+                                        OnErrorT && onError)
+{
+  str = Utils::Trim(str);
+  if (str.ends_with(s_holdEnd))
+  {
+    const size_t holdBegin = str.rfind(s_holdBegin);
+    if (holdBegin == std::string_view::npos)
+    {
+      onError(LogMessageType::Error, "Expected ( before hold duration", str);
+      return false;
+    }
+    result.holdTime = ParseDuration(str.substr(holdBegin + 1, str.size() - holdBegin - 2), onError);
+    str = str.substr(0, holdBegin);
+  }
+  return ParseChordCondition(str, result, onError);
+}
+
+/// @brief parses sequence of chords, like KeyLeftCtrl > KeyS(1s) >> KeyE
+///        Steps are reported as consecutive conditions, all steps except the first have maxDelay
+template<typename OnConditionT, typename OnErrorT>
+constexpr void ParseSequenceCondition(std::string_view str, OnConditionT && onCondition,
+                                      OnErrorT && onError)
+{
+  std::array<BindingCondition, SequenceStepsLimit> steps{};
+  size_t count = 0;
+  float maxDelay = 0.0f;
+  const std::string_view sequenceStr = str;
+  while (true)
+  {
+    const size_t end = str.find(s_nextButton);
+    BindingCondition step;
+    step.isSequenceStep = true;
+    step.maxDelay = maxDelay;
+    if (!ParseTimedChordCondition(str.substr(0, end), step, onError))
+    {
+      onError(LogMessageType::Error, "Expected button's chord in sequence", sequenceStr);
+      return;
+    }
+    if (count > 0 && steps[0].device != step.device)
+    {
+      onError(LogMessageType::Error, "Expected that all steps of sequence will be from one device",
+              sequenceStr);
+      return;
+    }
+    if (count == SequenceStepsLimit)
+    {
+      onError(LogMessageType::Error, "Too many steps in sequence", sequenceStr);
+      return;
+    }
+    steps[count++] = step;
+    if (end == std::string_view::npos)
+      break;
+
+    // every > adds timeout to the delay between steps
+    str.remove_prefix(end);
+    size_t delimiters = 0;
+    while (!str.empty() && str.front() == s_nextButton)
+    {
+      ++delimiters;
+      str.remove_prefix(1);
+    }
+    maxDelay = static_cast<float>(delimiters) * s_sequenceStepTimeout;
+  }
+  for (size_t i = 0; i < count; ++i)
+    onCondition(steps[i]);
+}
+
+/// @brief parses binding string, calls onCondition for every parsed condition
+///        and onError(LogMessageType, message, context) for every syntax error.
+///        It's constexpr, so the same code parses bindings at runtime and at compile time
+template<typename OnConditionT, typename OnErrorT>
+constexpr void ParseBindingConditions(std::string_view str, OnConditionT && onCondition,
+                                      OnErrorT && onError)
+{
+  ForEachToken(str, s_delimiter,
+               [&](std::string_view conditionStr)
+               {
+                 if (conditionStr.find(s_nextButton) != std::string_view::npos)
+                 {
+                   ParseSequenceCondition(conditionStr, onCondition, onError);
+                   return;
+                 }
+                 BindingCondition axes;
+                 if (ParseAxesCondition(conditionStr, axes, onError))
+                 {
+                   onCondition(axes);
+                   return;
+                 }
+                 BindingCondition chord;
+                 if (ParseTimedChordCondition(conditionStr, chord, onError))
+                 {
+                   onCondition(chord);
+                   return;
+                 }
+                 onError(LogMessageType::Error, "Expected axis or button's chord", conditionStr);
+               });
+}
+} // namespace details
+
+/// @brief binding parsed at compile time
+template<size_t Capacity>
+struct StaticBinding final
+{
+  std::array<BindingCondition, Capacity> conditions{};
+  size_t count = 0;
+
+  constexpr std::span<const BindingCondition> GetConditions() const noexcept
+  {
+    return {conditions.data(), count};
+  }
+};
+
+/// @brief parses binding string at compile time. Any error in the string is a compile error.
+///        Result should be stored in static constexpr variable and passed to InputBinding::parsed
+template<size_t Size>
+consteval auto ParseStaticBinding(const static_string<Size> & str)
+{
+  // every condition takes at least one symbol and a delimiter
+  StaticBinding<Size / 2 + 1> result;
+  const std::string_view view(str.c_str(), str.length());
+  if (view.empty())
+    throw std::invalid_argument("Binding expression was empty");
+  details::ParseBindingConditions(
+    view, [&result](const BindingCondition & condition)
+    { result.conditions[result.count++] = condition; },
+    [](LogMessageType, const char * message, std::string_view)
+    { throw std::invalid_argument(message); });
+  return result;
+}
+
+template<size_t Size>
+consteval auto ParseStaticBinding(const char (&str)[Size])
+{
+  return ParseStaticBinding(static_string<Size>(str));
+}
+
+} // namespace GameFramework
@@ -1,34 +1,107 @@
 #include "Plugin.hpp"
 
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
 #include <dylib.hpp>
+#include <Game/ThreadPool.hpp>
+#include <Utility/Logger.hpp>
+#include <Utility/Profiler.hpp>
 
 namespace GameFramework
 {
+namespace
+{
+/// rebuilt library is reloaded when it hasn't been changed for this time
+constexpr std::chrono::milliseconds s_settleTime{500};
+
+/// @brief file name which dylib::decorations::os_default() makes of plugin's path
+std::filesystem::path DecorateLibraryPath(const std::filesystem::path & path)
+{
+#if defined(_WIN32)
+  return std::filesystem::path(path).concat(".dll");
+#elif defined(__APPLE__)
+  return path.parent_path() / ("lib" + path.filename().string() + ".dylib");
+#else
+  return path.parent_path() / ("lib" + path.filename().string() + ".so");
+#endif
+}
+
+/// @brief returns file_time_type::min() if file doesn't exist
+std::filesystem::file_time_type GetWriteTime(const std::filesystem::path & path) noexcept
+{
+  std::error_code ec;
+  auto time = std::filesystem::last_write_time(path, ec);
+  return ec ? std::filesystem::file_time_type::min() : time;
+}
+
+void RemoveShadowCopy(const std::filesystem::path & path) noexcept
+{
+  std::error_code ec;
+  if (!path.empty())
+    std::filesystem::remove(path, ec);
+}
+} // namespace
 
 struct DylibPluginLoader : public IPluginLoader
 {
-  explicit DylibPluginLoader(const std::filesystem::path & path);
-  virtual ~DylibPluginLoader() override = default;
+  DylibPluginLoader(const std::filesystem::path & path, PluginManifest && manifest, bool hotReload);
+  virtual ~DylibPluginLoader() override;
 
   virtual IPluginInstance * GetInstance() override { return m_instance.get(); }
   virtual const std::filesystem::path & Path() const & noexcept override;
+  virtual const PluginManifest & GetManifest() const & noexcept override { return m_manifest; }
+  virtual double GetLoadTime() const noexcept override { return m_loadTime; }
+  virtual bool IsModified() const override;
+  virtual bool Reload(const PluginMigrateFunc & migrate) override;
 
 private:
   std::filesystem::path m_path;
-  dylib::library m_library;
+  PluginManifest m_manifest;
+  double m_loadTime = 0.0;
+  std::filesystem::path m_libraryPath; ///< original library, empty if plugin isn't hot-reloadable
+  std::filesystem::path m_shadowPath;  ///< loaded copy of original library
+  std::filesystem::file_time_type m_loadedWriteTime; ///< write time of the copied library
+  std::unique_ptr<dylib::library> m_library;
   std::unique_ptr<IPluginInstance> m_instance;
+
+private:
+  /// @brief copies original library to new file and loads it, so the original can be rebuilt
+  std::unique_ptr<dylib::library> LoadShadowCopy(std::filesystem::path & shadowPath);
+  std::unique_ptr<IPluginInstance> CreatePluginInstance(dylib::library & library);
 };
 
-DylibPluginLoader::DylibPluginLoader(const std::filesystem::path & path)
+DylibPluginLoader::DylibPluginLoader(const std::filesystem::path & path,
+                                     PluginManifest && manifest, bool hotReload)
   : m_path(path)
-  , m_library(path, dylib::decorations::os_default())
+  , m_manifest(std::move(manifest))
 {
+  PROFILE_ZONE("LoadPlugin");
+  const auto start = std::chrono::steady_clock::now();
   m_path = m_path.remove_filename();
-  using CreateInstanceFunc = decltype(CreateInstance);
-  auto createInstanceFunc = m_library.get_function<CreateInstanceFunc>(
-    "CreateInstance(GameFramework::IPluginLoader const &)");
-  if (createInstanceFunc)
-    m_instance = createInstanceFunc(*this);
+  if (hotReload)
+  {
+    m_libraryPath = DecorateLibraryPath(path);
+    m_library = LoadShadowCopy(m_shadowPath);
+  }
+  else
+  {
+    m_library = std::make_unique<dylib::library>(path, dylib::decorations::os_default());
+  }
+  m_instance = CreatePluginInstance(*m_library);
+  m_loadTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+DylibPluginLoader::~DylibPluginLoader()
+{
+  m_instance.reset();
+  // logged messages are formatted by code of the plugin, so they're written before unloading
+  FlushLog();
+  m_library.reset();
+  RemoveShadowCopy(m_shadowPath);
 }
 
 const std::filesystem::path & DylibPluginLoader::Path() const & noexcept
@@ -36,9 +109,118 @@ const std::filesystem::path & DylibPluginLoader::Path() const & noexcept
   return m_path;
 }
 
-GAME_FRAMEWORK_API std::unique_ptr<IPluginLoader> LoadPlugin(const std::filesystem::path & path)
+bool DylibPluginLoader::IsModified() const
+{
+  if (m_libraryPath.empty())
+    return false;
+  // library which is removed or still being written by linker isn't reported
+  const auto writeTime = GetWriteTime(m_libraryPath);
+  return writeTime != m_loadedWriteTime && writeTime != std::filesystem::file_time_type::min() &&
+         std::filesystem::file_time_type::clock::now() - writeTime > s_settleTime;
+}
+
+bool DylibPluginLoader::Reload(const PluginMigrateFunc & migrate)
+{
+  if (m_libraryPath.empty())
+    return false;
+
+  // new library is loaded next to the old one, so the game keeps running if it's broken
+  std::filesystem::path shadowPath;
+  std::unique_ptr<dylib::library> library;
+  std::unique_ptr<IPluginInstance> instance;
+  try
+  {
+    library = LoadShadowCopy(shadowPath);
+    instance = CreatePluginInstance(*library);
+  }
+  catch (const std::exception & e)
+  {
+    Log(LogMessageType::Warning, "Failed to reload plugin - ", e.what());
+  }
+  if (instance && migrate && m_instance && !migrate(*m_instance, *instance))
+  {
+    Log(LogMessageType::Warning, "Reloaded plugin is rejected - ", m_libraryPath.string());
+    instance.reset();
+  }
+  if (!instance)
+  {
+    FlushLog();
+    library.reset();
+    RemoveShadowCopy(shadowPath);
+    return false;
+  }
+
+  m_instance = std::move(instance);
+  FlushLog();
+  m_library = std::move(library);
+  RemoveShadowCopy(std::exchange(m_shadowPath, std::move(shadowPath)));
+  return true;
+}
+
+std::unique_ptr<dylib::library> DylibPluginLoader::LoadShadowCopy(
+  std::filesystem::path & shadowPath)
+{
+  // write time is taken before copying, so library which is written now is reloaded again
+  m_loadedWriteTime = GetWriteTime(m_libraryPath);
+  const auto shadowDir = std::filesystem::temp_directory_path() / "GameFramework_HotReload";
+  std::filesystem::create_directories(shadowDir);
+  // each copy has unique name, otherwise OS could return the library which is still loaded
+  const auto stamp = std::chrono::steady_clock::now().time_since_epoch().count();
+  shadowPath = shadowDir / m_libraryPath.stem();
+  shadowPath += "." + std::to_string(stamp);
+  shadowPath += m_libraryPath.extension();
+  std::filesystem::copy_file(m_libraryPath, shadowPath);
+  try
+  {
+    return std::make_unique<dylib::library>(shadowPath);
+  }
+  catch (...)
+  {
+    RemoveShadowCopy(shadowPath);
+    throw;
+  }
+}
+
+std::unique_ptr<IPluginInstance> DylibPluginLoader::CreatePluginInstance(dylib::library & library)
+{
+  using CreateInstanceFunc = decltype(CreateInstance);
+  // entry point is looked up by the name from manifest, not by a name compiled into launcher
+  auto createInstanceFunc = library.get_function<CreateInstanceFunc>(m_manifest.entryPoint);
+  return createInstanceFunc ? createInstanceFunc(*this) : nullptr;
+}
+
+GAME_FRAMEWORK_API std::unique_ptr<IPluginLoader> LoadPlugin(const std::filesystem::path & path,
+                                                             bool hotReload)
 {
-  return std::make_unique<DylibPluginLoader>(path);
+  return std::make_unique<DylibPluginLoader>(path, ReadPluginManifest(path), hotReload);
+}
+
+GAME_FRAMEWORK_API std::vector<std::unique_ptr<IPluginLoader>> LoadPlugins(
+  std::span<const PluginLoadInfo> plugins)
+{
+  PROFILE_FUNCTION();
+  // manifests are read without loading libraries, so the order is known before loading
+  std::vector<PluginManifest> manifests;
+  manifests.reserve(plugins.size());
+  for (auto && plugin : plugins)
+    manifests.push_back(ReadPluginManifest(plugin.path));
+  const auto stages = SortPluginsByDependencies(manifests);
+
+  std::vector<std::unique_ptr<IPluginLoader>> loaders(plugins.size());
+  for (auto && stage : stages)
+  {
+    GetThreadPool().ParallelFor(stage.size(),
+                                [&](size_t i)
+                                {
+                                  const size_t p = stage[i];
+                                  loaders[p] = std::make_unique<DylibPluginLoader>(
+                                    plugins[p].path, std::move(manifests[p]), plugins[p].hotReload);
+                                });
+  }
+  for (auto && loader : loaders)
+    Log(LogMessageType::Info, "Plugin ", loader->GetManifest().name, " ",
+        loader->GetManifest().version, " is loaded in ", loader->GetLoadTime() * 1000.0, " ms");
+  return loaders;
 }
 
 } // namespace GameFramework
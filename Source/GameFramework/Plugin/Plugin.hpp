@@ -2,7 +2,12 @@
 #include <GameFramework_def.h>
 
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <span>
+#include <vector>
+
+#include <Plugin/PluginManifest.hpp>
 
 namespace GameFramework
 {
@@ -13,14 +18,43 @@ struct GAME_FRAMEWORK_API IPluginInstance
   //virtual int GetVersion() const = 0;
 };
 
+/// @brief moves state from the instance of old library to the instance of reloaded one,
+///        returns false to reject the reloaded instance
+using PluginMigrateFunc = std::function<bool(IPluginInstance & from, IPluginInstance & to)>;
+
 struct IPluginLoader
 {
   virtual ~IPluginLoader() = default;
   virtual IPluginInstance * GetInstance() = 0;
   virtual const std::filesystem::path & Path() const & noexcept = 0;
+  virtual const PluginManifest & GetManifest() const & noexcept = 0;
+  /// @brief time of loading library and creating instance in seconds
+  virtual double GetLoadTime() const noexcept = 0;
+
+  /// @brief true if library of hot-reloadable plugin was rebuilt since it was loaded
+  virtual bool IsModified() const = 0;
+  /// @brief loads rebuilt library and creates new instance, old instance and library are
+  ///        destroyed after migration. Old ones are kept if new library can't be loaded
+  /// @return false if plugin isn't hot-reloadable, new library can't be loaded or it's rejected
+  virtual bool Reload(const PluginMigrateFunc & migrate) = 0;
 };
 
 PLUGIN_API std::unique_ptr<IPluginInstance> CreateInstance(const IPluginLoader & loader);
-GAME_FRAMEWORK_API std::unique_ptr<IPluginLoader> LoadPlugin(const std::filesystem::path & path);
+/// @param hotReload - load a shadow copy of library, so the original file can be rebuilt
+///                    while plugin is running and reloaded with IPluginLoader::Reload
+GAME_FRAMEWORK_API std::unique_ptr<IPluginLoader> LoadPlugin(const std::filesystem::path & path,
+                                                             bool hotReload = false);
+
+struct PluginLoadInfo
+{
+  std::filesystem::path path;
+  bool hotReload = false;
+};
+
+/// @brief reads manifests of plugins and loads them on thread pool, independent plugins are loaded
+///        in parallel and each plugin is loaded after its dependencies. Throws std::runtime_error
+/// @return loaders in the same order as plugins
+GAME_FRAMEWORK_API std::vector<std::unique_ptr<IPluginLoader>> LoadPlugins(
+  std::span<const PluginLoadInfo> plugins);
 
 } // namespace GameFramework
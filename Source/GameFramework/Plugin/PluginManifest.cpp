@@ -0,0 +1,113 @@
+#include "PluginManifest.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <Utility/StringUtils.hpp>
+
+namespace GameFramework
+{
+
+GAME_FRAMEWORK_API PluginManifest ParsePluginManifest(std::string_view text)
+{
+  PluginManifest manifest;
+  for (auto line : Utils::Split(text, '\n'))
+  {
+    line = Utils::Trim(line.substr(0, line.find('#')));
+    if (line.empty())
+      continue;
+
+    const size_t separator = line.find('=');
+    if (separator == std::string_view::npos)
+      throw std::runtime_error("Invalid line of plugin manifest - " + std::string(line));
+    const std::string_view key = Utils::Trim(line.substr(0, separator));
+    const std::string_view value = Utils::Trim(line.substr(separator + 1));
+    if (key == "name")
+      manifest.name = value;
+    else if (key == "version")
+      manifest.version = value;
+    else if (key == "entry")
+      manifest.entryPoint = value;
+    else if (key == "dependencies")
+    {
+      for (auto dependency : Utils::Split(value, ','))
+      {
+        if (dependency = Utils::Trim(dependency); !dependency.empty())
+          manifest.dependencies.emplace_back(dependency);
+      }
+    }
+    else
+      throw std::runtime_error("Unknown key of plugin manifest - " + std::string(key));
+  }
+  return manifest;
+}
+
+GAME_FRAMEWORK_API PluginManifest ReadPluginManifest(const std::filesystem::path & path)
+{
+  const auto manifestPath = std::filesystem::path(path).concat(".plugin");
+  PluginManifest manifest;
+  if (std::ifstream file(manifestPath); file)
+  {
+    std::stringstream text;
+    text << file.rdbuf();
+    try
+    {
+      manifest = ParsePluginManifest(text.str());
+    }
+    catch (const std::runtime_error & e)
+    {
+      throw std::runtime_error(std::string(e.what()) + " in " + manifestPath.string());
+    }
+  }
+  if (manifest.name.empty())
+    manifest.name = path.filename().string();
+  return manifest;
+}
+
+GAME_FRAMEWORK_API std::vector<std::vector<size_t>> SortPluginsByDependencies(
+  std::span<const PluginManifest> manifests)
+{
+  auto findPlugin = [manifests](const std::string & name)
+  {
+    auto it = std::ranges::find(manifests, name, &PluginManifest::name);
+    if (it == manifests.end())
+      throw std::runtime_error("Unknown plugin dependency - " + name);
+    return static_cast<size_t>(std::distance(manifests.begin(), it));
+  };
+
+  // stage of plugin is the next stage after the latest stage of its dependencies
+  constexpr size_t NoStage = static_cast<size_t>(-1);
+  std::vector<size_t> stages(manifests.size(), NoStage);
+  std::vector<std::vector<size_t>> result;
+  for (size_t sorted = 0; sorted < manifests.size();)
+  {
+    std::vector<size_t> stage;
+    for (size_t i = 0; i < manifests.size(); ++i)
+    {
+      if (stages[i] != NoStage)
+        continue;
+      const bool isReady = std::ranges::all_of(manifests[i].dependencies,
+                                               [&](const std::string & dependency)
+                                               {
+                                                 const size_t d = stages[findPlugin(dependency)];
+                                                 return d != NoStage && d < result.size();
+                                               });
+      if (isReady)
+        stage.push_back(i);
+    }
+    if (stage.empty())
+    {
+      const size_t unsorted = std::distance(stages.begin(), std::ranges::find(stages, NoStage));
+      throw std::runtime_error("Cyclic plugin dependency - " + manifests[unsorted].name);
+    }
+    for (size_t i : stage)
+      stages[i] = result.size();
+    sorted += stage.size();
+    result.push_back(std::move(stage));
+  }
+  return result;
+}
+
+} // namespace GameFramework
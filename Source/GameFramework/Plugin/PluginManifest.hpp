@@ -0,0 +1,46 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GameFramework
+{
+
+/*
+* Manifest is a text file "<plugin>.plugin" next to the plugin's library:
+*   # comment
+*   name = RenderPlugin_RHI
+*   version = 1.0
+*   dependencies = GlfwWindowPlugin, SomeOtherPlugin
+*   entry = CreateInstance(GameFramework::IPluginLoader const &)
+* All keys are optional
+*/
+struct PluginManifest
+{
+  std::string name;
+  std::string version;
+  std::vector<std::string> dependencies; ///< names of plugins which are loaded before this one
+  std::string entryPoint = "CreateInstance(GameFramework::IPluginLoader const &)";
+};
+
+/// @brief throws std::runtime_error for invalid lines and unknown keys
+GAME_FRAMEWORK_API PluginManifest ParsePluginManifest(std::string_view text);
+
+/// @brief reads manifest of plugin without loading its library. If there is no manifest,
+///        plugin is named by its file and has no dependencies. Throws std::runtime_error
+/// @param path - path of plugin as it's passed to LoadPlugin
+GAME_FRAMEWORK_API PluginManifest ReadPluginManifest(const std::filesystem::path & path);
+
+/// @brief splits plugins into stages, plugins of a stage depend only on plugins of previous stages,
+///        so plugins of one stage can be loaded in parallel.
+///        Throws std::runtime_error if dependency is unknown or cyclic
+/// @return indices of manifests for each stage
+GAME_FRAMEWORK_API std::vector<std::vector<size_t>> SortPluginsByDependencies(
+  std::span<const PluginManifest> manifests);
+
+} // namespace GameFramework
@@ -20,4 +20,18 @@ void GamePlugin::ProcessInput()
   }
 }
 
+GAME_FRAMEWORK_API bool ReloadGamePlugin(IPluginLoader & loader)
+{
+  return loader.Reload(
+    [](IPluginInstance & from, IPluginInstance & to)
+    {
+      auto * oldGame = dynamic_cast<GamePlugin *>(&from);
+      auto * newGame = dynamic_cast<GamePlugin *>(&to);
+      if (!oldGame || !newGame)
+        return false;
+      newGame->DeserializeState(oldGame->SerializeState());
+      return true;
+    });
+}
+
 } // namespace GameFramework
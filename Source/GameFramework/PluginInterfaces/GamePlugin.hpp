@@ -1,6 +1,8 @@
 /// It's functions which should be implemented in dll for Game Framework detected it as Game
 #pragma once
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
 #include <variant>
 #include <vector>
@@ -20,6 +22,7 @@ struct ProtoWindow
   std::string title;
   int width;
   int height;
+  PresentMode presentMode = PresentMode::TripleBuffering;
 };
 
 struct GAME_FRAMEWORK_API GamePlugin : public IPluginInstance,
@@ -30,15 +33,31 @@ struct GAME_FRAMEWORK_API GamePlugin : public IPluginInstance,
   virtual std::string GetGameName() const = 0;
   virtual std::vector<InputBinding> GetInputConfiguration() const = 0;
   virtual std::vector<ProtoWindow> GetOutputConfiguration() const = 0;
+  /// @brief frames per second which launcher keeps, 0 - unlimited
+  virtual double GetTargetFrameRate() const { return 0.0; }
 
+  /// @brief fill retained scene once on start. The scene belongs to the render plugin and
+  ///        survives hot-reload of the game, so it isn't called for the reloaded instance
+  virtual void LoadScene(IRetainedScene3D &) {}
   virtual void Tick(double deltaTime) = 0;
   virtual void Render(GameFramework::IDevice & device) = 0;
   void ProcessInput();
 
+  /// @brief state which survives hot-reload of the game's library. It must not point to memory
+  ///        or code of the old library, because it's unloaded right after DeserializeState
+  virtual std::vector<std::byte> SerializeState() const { return {}; }
+  /// @brief called on the reloaded instance instead of starting the game from scratch
+  virtual void DeserializeState(std::span<const std::byte>) {}
+
 protected:
   virtual void OnAction(const EventAction & action) {};
   virtual void OnAction(const ContinousAction & action) {};
   virtual void OnAction(const AxisAction & action) {};
 };
 
+/// @brief reloads rebuilt library of the game and moves state of the game to the new instance.
+///        Queues must be bound to the new instance again
+/// @return false if library can't be reloaded, the old instance is kept then
+GAME_FRAMEWORK_API bool ReloadGamePlugin(IPluginLoader & loader);
+
 } // namespace GameFramework
@@ -10,12 +10,20 @@
 namespace GameFramework
 {
 
+/// @brief how rendered frames are queued for presentation
+enum class PresentMode : uint8_t
+{
+  DoubleBuffering, ///< lower latency, CPU waits for GPU more often
+  TripleBuffering, ///< smoother frame times for cost of one frame of latency
+};
+
 ///  
 struct IDevice
 {
   virtual ~IDevice() = default;
   virtual Scene2DUPtr AcquireScene2D() = 0;
   virtual Scene3DUPtr AcquireScene3D() = 0;
+  virtual IRetainedScene3D & GetRetainedScene3D() & noexcept = 0;
   virtual int GetOwnerId() const noexcept = 0;
   virtual float GetAspectRatio() const noexcept = 0;
 };
@@ -35,7 +43,9 @@ using ScreenDeviceUPtr = std::unique_ptr<IScreenDevice>;
 struct RenderPlugin : public IPluginInstance
 {
   virtual ~RenderPlugin() = default;
-  virtual ScreenDeviceUPtr CreateScreenDevice(IWindow & window) = 0;
+  virtual ScreenDeviceUPtr CreateScreenDevice(IWindow & window, PresentMode presentMode) = 0;
+  /// @brief scene which is drawn by all devices, the same as IDevice::GetRetainedScene3D
+  virtual IRetainedScene3D & GetRetainedScene3D() & noexcept = 0;
   virtual void Tick() = 0;
 };
 
@@ -37,6 +37,8 @@ struct WindowsPlugin : public IPluginInstance
   virtual ~WindowsPlugin() = default;
   virtual WindowUPtr NewWindow(int id, const std::string & title, int width, int height) = 0;
   virtual void PollEvents() = 0;
+  /// @brief like PollEvents, but blocks until some event comes or timeout (in seconds) expires
+  virtual void WaitEvents(double timeout) = 0;
 };
 
 
@@ -0,0 +1,118 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace GameFramework
+{
+
+/// @brief range of instances [first, last)
+struct InstanceRange final
+{
+  size_t first = 0;
+  size_t last = 0;
+
+  bool Empty() const noexcept { return first >= last; }
+  size_t Size() const noexcept { return Empty() ? 0 : last - first; }
+};
+
+/*
+* CPU-side storage of per-instance data for instanced renderers.
+* Instances of the frame are collected, then Commit compares them with the previous
+* committed frame and accumulates the range of changed instances until it's uploaded.
+* Capacity grows geometrically, so GPU buffer is reallocated rarely
+*/
+template<typename InstanceT>
+  requires(std::is_trivially_copyable_v<InstanceT>)
+class InstanceBatch final
+{
+public:
+  static constexpr size_t MinCapacity = 64;
+
+  InstanceBatch() = default;
+
+  /// @brief begin collection of new frame
+  void Clear() noexcept { m_pending.clear(); }
+  void Reserve(size_t count) { m_pending.reserve(count); }
+  void Push(const InstanceT & instance) { m_pending.push_back(instance); }
+  template<typename... Args>
+  InstanceT & Emplace(Args &&... args)
+  {
+    return m_pending.emplace_back(std::forward<Args>(args)...);
+  }
+  /// @brief replace collected instances of the frame
+  void Assign(std::span<const InstanceT> instances)
+  {
+    m_pending.assign(instances.begin(), instances.end());
+  }
+
+  /// @brief compares collected instances with committed ones
+  /// @return true if anything has been changed
+  bool Commit()
+  {
+    const InstanceRange changed = FindChangedRange();
+    std::swap(m_pending, m_committed);
+    if (changed.Empty() && m_pending.size() == m_committed.size())
+      return false;
+
+    if (m_dirty.Empty())
+      m_dirty = changed;
+    else
+      m_dirty = {std::min(m_dirty.first, changed.first), std::max(m_dirty.last, changed.last)};
+    m_dirty.last = std::min(m_dirty.last, m_committed.size());
+    if (m_committed.size() > m_capacity)
+      m_capacity = CalcCapacity(m_committed.size());
+    return true;
+  }
+
+  /// @brief instances of last committed frame
+  std::span<const InstanceT> GetInstances() const noexcept { return m_committed; }
+  size_t Size() const noexcept { return m_committed.size(); }
+  bool Empty() const noexcept { return m_committed.empty(); }
+
+  /// @brief instances changed since last MarkUploaded
+  InstanceRange GetDirtyRange() const noexcept { return m_dirty; }
+  bool IsDirty() const noexcept { return !m_dirty.Empty(); }
+  void MarkUploaded() noexcept { m_dirty = {}; }
+
+  /// @brief count of instances that GPU buffer should be able to store
+  size_t GetCapacity() const noexcept { return m_capacity; }
+
+  static size_t CalcCapacity(size_t count) noexcept
+  {
+    return std::bit_ceil(std::max(count, MinCapacity));
+  }
+
+private:
+  std::vector<InstanceT> m_pending;
+  std::vector<InstanceT> m_committed;
+  InstanceRange m_dirty;
+  size_t m_capacity = 0;
+
+private:
+  InstanceRange FindChangedRange() const noexcept
+  {
+    const size_t common = std::min(m_pending.size(), m_committed.size());
+    size_t first = 0;
+    while (first < common && Equal(m_pending[first], m_committed[first]))
+      ++first;
+
+    size_t last = m_pending.size();
+    if (m_pending.size() == m_committed.size())
+    {
+      while (last > first && Equal(m_pending[last - 1], m_committed[last - 1]))
+        --last;
+    }
+    return {first, last};
+  }
+
+  static bool Equal(const InstanceT & lhs, const InstanceT & rhs) noexcept
+  {
+    return std::memcmp(&lhs, &rhs, sizeof(InstanceT)) == 0;
+  }
+};
+
+} // namespace GameFramework
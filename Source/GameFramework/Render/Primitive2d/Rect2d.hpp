@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Render/Color.hpp>
 #include <Render/RenderPrimitive.hpp>
 
 namespace GameFramework
@@ -7,21 +8,24 @@ namespace GameFramework
 struct GAME_FRAMEWORK_API Rect2d : public IRenderPrimitive
 {
   Rect2d() = default;
-  Rect2d(float left, float top, float width, float height);
-
-public: // IRenderPrimitive
-  virtual size_t Hash() const noexcept override;
+  Rect2d(float left, float top, float width, float height, const Color4f & color = {1, 0, 0, 1},
+         float z = 0.0f);
 
 public:
   float X() const noexcept { return m_left; }
   float Y() const noexcept { return m_top; }
   float Width() const noexcept { return m_width; }
   float Height() const noexcept { return m_height; }
+  const Color4f & GetColor() const & noexcept { return m_color; }
+  /// @brief depth of rect in range [0, 1]
+  float Z() const noexcept { return m_z; }
 
 private:
   float m_left = 0;
   float m_top = 0;
   float m_width = 0;
   float m_height = 0;
+  Color4f m_color{1, 0, 0, 1};
+  float m_z = 0;
 };
 } // namespace GameFramework
@@ -3,9 +3,7 @@
 #include "Camera.hpp"
 
 #include <glm/ext.hpp>
-#include <Utility/Utility.hpp>
 
-#include "glm/gtx/hash.hpp"
 namespace
 {
 glm::vec3 OrthogonalVector(const glm::vec3 & v1, const glm::vec3 & v2)
@@ -56,13 +54,6 @@ Mat4f Camera::GetVP() const noexcept
   return CastFromGLM(CastToGLM(m_viewMatrix) * CastToGLM(m_projMatrix));
 }
 
-size_t Camera::Hash() const noexcept
-{
-  size_t hash = 0;
-  Utils::hash_combine(hash, CastToGLM(m_viewMatrix), CastToGLM(m_projMatrix));
-  return hash;
-}
-
 //Vec3f Camera::GetRightVector() const noexcept
 //{
 //  return -OrthogonalVector(m_up, m_direction);
@@ -35,9 +35,6 @@ public:
   Mat4f GetVP() const noexcept;
   //Vec3f GetRightVector() const noexcept;
   //Vec3f GetFrontVector() const noexcept;
-public:
-  virtual size_t Hash() const noexcept override;
-
 private:
   bool m_isPerspective = false;
   Mat4f m_projMatrix;
@@ -2,7 +2,7 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include "Cube.hpp"
 
-#include "glm/gtx/hash.hpp"
+#include <glm/ext.hpp>
 
 namespace GameFramework
 {
@@ -18,14 +18,14 @@ Cube::Cube(const Vec3f & pos)
   m_transform = CastFromGLM(m);
 }
 
-const Mat4f & Cube::GetTransform() const & noexcept
+Cube::Cube(const Mat4f & transform)
+  : m_transform(transform)
 {
-  return m_transform;
 }
 
-size_t Cube::Hash() const noexcept
+const Mat4f & Cube::GetTransform() const & noexcept
 {
-  return std::hash<glm::mat4>{}(CastToGLM(m_transform));
+  return m_transform;
 }
 
 } // namespace GameFramework
@@ -8,13 +8,12 @@ struct GAME_FRAMEWORK_API Cube : public IRenderPrimitive
 {
   Cube();
   explicit Cube(const Vec3f & pos);
+  /// @brief cube with world matrix, e.g. from TransformHierarchy
+  explicit Cube(const Mat4f & transform);
 
 public:
   const Mat4f & GetTransform() const & noexcept;
 
-public:
-  virtual size_t Hash() const noexcept override;
-
 private:
   Mat4f m_transform;
 };
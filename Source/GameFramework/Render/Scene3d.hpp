@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+#include <limits>
 #include <memory>
 
 #include <Render/Primitive3d/Camera.hpp>
@@ -14,4 +16,36 @@ struct IRenderableScene3D
 };
 
 using Scene3DUPtr = std::unique_ptr<IRenderableScene3D>;
+
+/// @brief handle of the object which is stored in retained scene
+///        generation protects from using of handle to removed object
+struct RenderObjectHandle final
+{
+  uint32_t index = std::numeric_limits<uint32_t>::max();
+  uint32_t generation = 0;
+
+  constexpr bool IsValid() const noexcept
+  {
+    return index != std::numeric_limits<uint32_t>::max();
+  }
+  constexpr bool operator==(const RenderObjectHandle & rhs) const noexcept = default;
+};
+
+/// @brief Retained-mode scene. Objects live in it between frames,
+///        so game creates them once and reports only changes.
+///        Camera is set per frame with IRenderableScene3D::SetCamera
+struct IRetainedScene3D
+{
+  virtual ~IRetainedScene3D() = default;
+  /// @brief add new cube into the scene
+  /// @return handle to update or remove the cube
+  virtual RenderObjectHandle AddCube(const Cube & cube) = 0;
+  /// @brief change existing cube. Invalid handles are ignored
+  virtual void UpdateCube(RenderObjectHandle handle, const Cube & cube) = 0;
+  /// @brief remove object from the scene. Invalid handles are ignored
+  virtual void RemoveObject(RenderObjectHandle handle) = 0;
+  /// @brief get count of objects in the scene
+  virtual size_t GetObjectsCount() const noexcept = 0;
+};
+
 } // namespace GameFramework
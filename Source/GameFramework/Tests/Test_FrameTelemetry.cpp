@@ -0,0 +1,64 @@
+#include <chrono>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <Game/FramePacer.hpp>
+#include <Game/FrameTelemetry.hpp>
+using namespace GameFramework;
+
+TEST_CASE("Telemetry stores last frames in ring buffer", "[FrameTelemetry]")
+{
+  FrameTelemetry telemetry;
+  const size_t framesCount = FrameTelemetry::Capacity + 10;
+  for (size_t i = 0; i < framesCount; ++i)
+  {
+    telemetry.Record(FrameStage::Tick, static_cast<double>(i));
+    telemetry.EndFrame();
+  }
+  REQUIRE(telemetry.GetFramesCount() == FrameTelemetry::Capacity);
+  REQUIRE(telemetry.GetFrame(0)[FrameStage::Tick] == 10.0);
+  REQUIRE(telemetry.GetFrame(FrameTelemetry::Capacity - 1)[FrameStage::Tick] ==
+          static_cast<double>(framesCount - 1));
+
+  telemetry.Reset();
+  REQUIRE(telemetry.GetFramesCount() == 0);
+  REQUIRE(telemetry.GetStats(FrameStage::Tick).max == 0.0);
+}
+
+TEST_CASE("Telemetry accumulates stage time and calculates percentiles", "[FrameTelemetry]")
+{
+  FrameTelemetry telemetry;
+  for (int i = 1; i <= 100; ++i)
+  {
+    telemetry.Record(FrameStage::Render, 0.5 * i);
+    telemetry.Record(FrameStage::Render, 0.5 * i);
+    telemetry.EndFrame();
+  }
+  REQUIRE(telemetry.GetPercentile(FrameStage::Render, 0.0) == 1.0);
+  REQUIRE(telemetry.GetPercentile(FrameStage::Render, 100.0) == 100.0);
+
+  auto stats = telemetry.GetStats(FrameStage::Render);
+  REQUIRE(stats.min == 1.0);
+  REQUIRE(stats.max == 100.0);
+  REQUIRE(stats.average == Catch::Approx(50.5));
+  REQUIRE(stats.p50 == 50.0);
+  REQUIRE(stats.p95 == 95.0);
+  REQUIRE(stats.p99 == 99.0);
+  REQUIRE(telemetry.GetFrame(0)[FrameStage::Total] >= 0.0);
+}
+
+TEST_CASE("FramePacer keeps target frame rate", "[FramePacer]")
+{
+  using Clock = std::chrono::steady_clock;
+  FramePacer pacer(200.0);
+  pacer.Wait();
+  const auto start = Clock::now();
+  for (int i = 0; i < 20; ++i)
+    pacer.Wait();
+  const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+  REQUIRE(elapsed >= 0.099);
+  REQUIRE(elapsed < 0.5);
+
+  pacer.SetTargetFrameRate(0.0);
+  REQUIRE(pacer.Wait() == 0.0);
+}
@@ -0,0 +1,34 @@
+#include <numeric>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <Utility/Hash.hpp>
+using namespace GameFramework;
+
+TEST_CASE("Hash of bytes depends on content and length", "[Hash]")
+{
+  std::vector<uint8_t> data(256);
+  std::iota(data.begin(), data.end(), uint8_t{0});
+
+  // all lengths are processed by different branches (<4, <=16, <=48, >48)
+  for (size_t len : {0, 1, 3, 4, 8, 16, 17, 47, 48, 49, 100, 256})
+  {
+    std::span<const uint8_t> bytes(data.data(), len);
+    const uint64_t h = Utils::HashSpan(bytes);
+    REQUIRE(h == Utils::HashSpan(bytes));
+    if (len > 0)
+    {
+      REQUIRE(h != Utils::HashSpan(bytes.first(len - 1)));
+      std::vector<uint8_t> modified(bytes.begin(), bytes.end());
+      modified[len / 2] ^= 1;
+      REQUIRE(h != Utils::HashSpan(std::span<const uint8_t>(modified)));
+    }
+  }
+}
+
+TEST_CASE("Hash of bytes depends on seed", "[Hash]")
+{
+  const float values[] = {1.0f, 2.0f, 3.0f, 4.0f};
+  REQUIRE(Utils::HashSpan(std::span<const float>(values), 0) !=
+          Utils::HashSpan(std::span<const float>(values), 1));
+}
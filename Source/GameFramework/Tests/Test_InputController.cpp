@@ -0,0 +1,580 @@
+#include <array>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <Game/Time.hpp>
+#include <Input/InputController.hpp>
+#include <Input/InputPoller.hpp>
+using namespace GameFramework;
+
+namespace
+{
+/// backend with manually set state of buttons and axes
+struct FakeInputBackend final : public InputBackend
+{
+  std::array<PressState, static_cast<size_t>(InputButton::TOTAL)> buttons{};
+  AxesValue cursor{AxisNoValue, AxisNoValue, AxisNoValue};
+  AxesValue motion{0.0f, 0.0f, 0.0f}; ///< accumulated MouseDeltaX, MouseDeltaY, MouseScrollY
+  mutable size_t bulkCalls = 0;
+  bool eventDriven = false;
+  bool deviceChanged = true;
+  InputController * controller = nullptr;
+
+  virtual void BindController(InputController * controller) override
+  {
+    this->controller = controller;
+    if (controller)
+    {
+      controller->OnNewInputDeviceConnected(InputDevice::KEYBOARD, true);
+      controller->OnNewInputDeviceConnected(InputDevice::MOUSE, true);
+    }
+  }
+
+  virtual bool IsEventDriven(InputDevice device) const noexcept override { return eventDriven; }
+  virtual bool HasDeviceChanged(InputDevice device) const noexcept override
+  {
+    return deviceChanged;
+  }
+
+  virtual PressState CheckButtonState(InputDevice device, InputButton btn) const noexcept override
+  {
+    return GetDeviceByButton(btn) == device ? buttons[static_cast<size_t>(btn)]
+                                            : PressState::RELEASED;
+  }
+
+  virtual void CheckButtonsState(InputDevice device, std::span<const InputButton> btns,
+                                 std::span<PressState> states) const noexcept override
+  {
+    ++bulkCalls;
+    InputBackend::CheckButtonsState(device, btns, states);
+  }
+
+  virtual AxisValue CheckAxisState(InputDevice device, InputAxis axis) const noexcept override
+  {
+    if (device != InputDevice::MOUSE)
+      return AxisNoValue;
+    switch (axis)
+    {
+      case InputAxis::MOUSE_DELTA_X:
+        return motion[0];
+      case InputAxis::MOUSE_DELTA_Y:
+        return motion[1];
+      case InputAxis::MOUSE_SCROLL_Y:
+        return motion[2];
+      default:
+        return axis == InputAxis::MOUSE_CURSOR_X ? cursor[0] : cursor[1];
+    }
+  }
+
+  virtual InputDeviceDescription GetInputDeviceDescription(
+    InputDevice device) const noexcept override
+  {
+    return {};
+  }
+
+  void Set(InputButton btn, PressState state, double timestamp = 0.0)
+  {
+    buttons[static_cast<size_t>(btn)] = state;
+    if (eventDriven && controller)
+      controller->OnButtonStateChanged({timestamp, GetDeviceByButton(btn), btn, state});
+  }
+};
+
+/// counts polls, waiting for events just sleeps
+struct FakeWindowsPlugin final : public WindowsPlugin
+{
+  size_t polls = 0;
+  size_t waits = 0;
+
+  virtual WindowUPtr NewWindow(int id, const std::string & title, int width,
+                               int height) override
+  {
+    return nullptr;
+  }
+  virtual void PollEvents() override { ++polls; }
+  virtual void WaitEvents(double timeout) override
+  {
+    ++waits;
+    std::this_thread::sleep_for(std::chrono::duration<double>(timeout));
+  }
+};
+
+std::vector<GameInputEvent> PopEvents(InputQueue & queue)
+{
+  std::vector<GameInputEvent> result;
+  while (auto event = queue.PopEvent())
+    result.push_back(*event);
+  return result;
+}
+
+enum Actions
+{
+  Jump,
+  Sprint,
+  Look,
+  Dash,
+  Use,
+  Save,
+  Zoom,
+};
+} // namespace
+
+TEST_CASE("Chords are evaluated from device snapshot", "[InputController]")
+{
+  FakeInputBackend backend;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Jump", Jump, "KeySpace; MouseButtonRight", ActionType::Event},
+    {"Sprint", Sprint, "KeyW+KeyLeftShift", ActionType::Continous},
+    {"Look", Look, "MouseCursorX+MouseCursorY", ActionType::Axis},
+  };
+  controller->SetInputBindings(bindings);
+
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  // one bulk request per device instead of one request per button
+  REQUIRE(backend.bulkCalls == 2);
+
+  backend.Set(InputButton::KEY_W, PressState::JUST_PRESSED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+
+  backend.Set(InputButton::KEY_LEFT_SHIFT, PressState::JUST_PRESSED);
+  backend.Set(InputButton::MOUSE_BUTTON_RIGHT, PressState::JUST_PRESSED);
+  controller->GenerateInputEvents();
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 2);
+  size_t sprints = 0, jumps = 0;
+  for (auto && event : events)
+  {
+    if (auto * action = std::get_if<ContinousAction>(&event))
+      sprints += action->code == Sprint;
+    if (auto * action = std::get_if<EventAction>(&event))
+      jumps += action->code == Jump && action->device == InputDevice::MOUSE;
+  }
+  REQUIRE(sprints == 1);
+  REQUIRE(jumps == 1);
+
+  // event is fired once, continous action is fired while it's active
+  controller->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::holds_alternative<ContinousAction>(events[0]));
+
+  backend.Set(InputButton::KEY_W, PressState::RELEASED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+}
+
+TEST_CASE("Axes are reported with delta", "[InputController]")
+{
+  FakeInputBackend backend;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Look", Look, "MouseCursorX+MouseCursorY", ActionType::Axis},
+  };
+  controller->SetInputBindings(bindings);
+
+  backend.cursor = {10.0f, 20.0f, AxisNoValue};
+  controller->GenerateInputEvents();
+  backend.cursor = {15.0f, 18.0f, AxisNoValue};
+  controller->GenerateInputEvents();
+
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 2);
+  auto && axis = std::get<AxisAction>(events[1]);
+  REQUIRE(axis.code == Look);
+  REQUIRE(axis.axisValue[0] == 15.0f);
+  REQUIRE(axis.deltaValue[0] == 5.0f);
+  REQUIRE(axis.deltaValue[1] == -2.0f);
+}
+
+TEST_CASE("Relative axes report accumulated motion", "[InputController]")
+{
+  FakeInputBackend backend;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Look", Look, "MouseDeltaX+MouseDeltaY", ActionType::Axis},
+    {"Zoom", Zoom, "MouseScrollY", ActionType::Axis},
+  };
+  controller->SetInputBindings(bindings);
+
+  backend.motion = {3.0f, -1.0f, 0.0f};
+  controller->GenerateInputEvents();
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  auto && look = std::get<AxisAction>(events[0]);
+  REQUIRE(look.code == Look);
+  REQUIRE(look.axisValue[0] == 3.0f);
+  REQUIRE(look.deltaValue[0] == 3.0f);
+  REQUIRE(look.deltaValue[1] == -1.0f);
+
+  // the same accumulated value on the next poll is a new motion, not a position
+  backend.motion = {3.0f, 0.0f, 2.0f};
+  controller->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 2);
+  for (auto && event : events)
+  {
+    auto && action = std::get<AxisAction>(event);
+    REQUIRE(action.deltaValue[0] == (action.code == Look ? 3.0f : 2.0f));
+  }
+
+  // no motion - no events
+  backend.motion = {0.0f, 0.0f, 0.0f};
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+
+  // unchanged device has no motion even if backend keeps old accumulators
+  backend.motion = {5.0f, 5.0f, 5.0f};
+  controller->GenerateInputEvents();
+  backend.deviceChanged = false;
+  PopEvents(queue);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+}
+
+TEST_CASE("Event-driven backend isn't polled", "[InputController]")
+{
+  FakeInputBackend backend;
+  backend.eventDriven = true;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Jump", Jump, "KeySpace", ActionType::Event},
+    {"Sprint", Sprint, "KeyW+KeyLeftShift", ActionType::Continous},
+  };
+  controller->SetInputBindings(bindings);
+
+  // snapshot of new bindings is read once, then only events change it
+  for (int i = 0; i < 10; ++i)
+    controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  REQUIRE(backend.bulkCalls == 1);
+
+  // buttons which aren't used in bindings are ignored
+  backend.Set(InputButton::KEY_Q, PressState::JUST_PRESSED);
+  backend.Set(InputButton::KEY_W, PressState::JUST_PRESSED, 1.0);
+  backend.Set(InputButton::KEY_LEFT_SHIFT, PressState::JUST_PRESSED, 2.0);
+  backend.Set(InputButton::KEY_SPACE, PressState::JUST_PRESSED);
+  controller->GenerateInputEvents();
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 2);
+  for (auto && event : events)
+  {
+    if (auto * action = std::get_if<ContinousAction>(&event))
+      REQUIRE(action->activeStart == 2.0);
+  }
+
+  backend.Set(InputButton::KEY_SPACE, PressState::RELEASED);
+  controller->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<ContinousAction>(events[0]).code == Sprint);
+
+  backend.Set(InputButton::KEY_LEFT_SHIFT, PressState::RELEASED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  REQUIRE(backend.bulkCalls == 1);
+}
+
+TEST_CASE("Key held across rebind stays pressed", "[InputController]")
+{
+  FakeInputBackend backend;
+  backend.eventDriven = true;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Sprint", Sprint, "KeyW", ActionType::Continous},
+  };
+  controller->SetInputBindings(bindings);
+  controller->GenerateInputEvents();
+  backend.Set(InputButton::KEY_W, PressState::JUST_PRESSED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).size() == 1);
+
+  // no event comes for the held key, so its state is read from the device
+  bindings.push_back({"Jump", Jump, "KeySpace", ActionType::Event});
+  controller->SetInputBindings(bindings);
+  controller->GenerateInputEvents();
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<ContinousAction>(events[0]).code == Sprint);
+
+  backend.Set(InputButton::KEY_W, PressState::RELEASED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+}
+
+TEST_CASE("Unchanged polled devices aren't read", "[InputController]")
+{
+  FakeInputBackend backend;
+  backend.deviceChanged = false;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Jump", Jump, "KeySpace", ActionType::Event},
+  };
+  controller->SetInputBindings(bindings);
+
+  // new bindings are read once anyway
+  backend.Set(InputButton::KEY_SPACE, PressState::JUST_PRESSED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).size() == 1);
+  REQUIRE(backend.bulkCalls == 1);
+
+  backend.Set(InputButton::KEY_SPACE, PressState::RELEASED);
+  for (int i = 0; i < 10; ++i)
+    controller->GenerateInputEvents();
+  REQUIRE(backend.bulkCalls == 1);
+
+  // release is read when the device reports the change
+  backend.deviceChanged = true;
+  controller->GenerateInputEvents();
+  backend.Set(InputButton::KEY_SPACE, PressState::JUST_PRESSED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).size() == 1);
+  REQUIRE(backend.bulkCalls == 3);
+}
+
+TEST_CASE("Chords are packed in words of predicates", "[InputController]")
+{
+  FakeInputBackend backend;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  // 3 predicates per chord, so some chords are moved to the next word
+  std::vector<InputBinding> bindings;
+  for (int i = 0; i < 50; ++i)
+    bindings.push_back({"Combo", i, "KeyA+KeyB+KeyC", ActionType::Event});
+  controller->SetInputBindings(bindings);
+
+  backend.Set(InputButton::KEY_A, PressState::JUST_PRESSED);
+  backend.Set(InputButton::KEY_B, PressState::JUST_PRESSED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+
+  backend.Set(InputButton::KEY_C, PressState::JUST_PRESSED);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).size() == bindings.size());
+}
+
+TEST_CASE("Presses between frames aren't lost", "[InputController]")
+{
+  FakeInputBackend backend;
+  backend.eventDriven = true;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Jump", Jump, "KeySpace", ActionType::Event},
+    {"Sprint", Sprint, "KeyLeftShift", ActionType::Continous},
+  };
+  controller->SetInputBindings(bindings);
+
+  backend.Set(InputButton::KEY_SPACE, PressState::JUST_PRESSED, 1.0);
+  backend.Set(InputButton::KEY_SPACE, PressState::RELEASED, 1.01);
+  backend.Set(InputButton::KEY_LEFT_SHIFT, PressState::JUST_PRESSED, 1.0);
+  backend.Set(InputButton::KEY_LEFT_SHIFT, PressState::RELEASED, 1.25);
+  controller->GenerateInputEvents();
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 2);
+  REQUIRE(std::get<EventAction>(events[0]).code == Jump);
+  auto && sprint = std::get<ContinousAction>(events[1]);
+  REQUIRE(sprint.activeStart == 1.0);
+  REQUIRE(sprint.activeDuration == 0.25);
+}
+
+TEST_CASE("Sequences and holds are driven by timestamps of changes", "[InputController]")
+{
+  FakeInputBackend backend;
+  backend.eventDriven = true;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Dash", Dash, "KeyD > KeyD", ActionType::Event},
+    {"Use", Use, "KeyE(1s)", ActionType::Event},
+    {"Save", Save, "KeyLeftCtrl >> KeyS", ActionType::Event},
+  };
+  controller->SetInputBindings(bindings);
+
+  auto tap = [&backend](InputButton btn, double timestamp)
+  {
+    backend.Set(btn, PressState::JUST_PRESSED, timestamp);
+    backend.Set(btn, PressState::RELEASED, timestamp + 0.05);
+  };
+
+  // double tap
+  tap(InputButton::KEY_D, 1.0);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  tap(InputButton::KEY_D, 1.2);
+  controller->GenerateInputEvents();
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == Dash);
+
+  // second tap is too late, it starts the sequence again
+  tap(InputButton::KEY_D, 3.0);
+  tap(InputButton::KEY_D, 4.0);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  tap(InputButton::KEY_D, 4.3);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).size() == 1);
+
+  // >> allows longer delay between steps
+  backend.Set(InputButton::KEY_LEFT_CONTROL, PressState::JUST_PRESSED, 5.0);
+  tap(InputButton::KEY_S, 5.8);
+  controller->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == Save);
+
+  // hold is completed by time even if there are no changes
+  GetTimeManager().Tick();
+  const double now = GetTimeManager().Timestamp();
+  backend.Set(InputButton::KEY_E, PressState::JUST_PRESSED, now - 0.5);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  backend.Set(InputButton::KEY_E, PressState::RELEASED, now - 0.4);
+  backend.Set(InputButton::KEY_E, PressState::JUST_PRESSED, now - 2.0);
+  controller->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == Use);
+}
+
+TEST_CASE("Held keys and modifiers satisfy pressed chords", "[InputController]")
+{
+  FakeInputBackend backend;
+  backend.eventDriven = true;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+
+  std::vector<InputBinding> bindings = {
+    {"Jump", Jump, "KeySpace", ActionType::Event},
+    {"Use", Use, "KeyE(1s)", ActionType::Event},
+    {"Save", Save, "KeyLeftCtrl > KeyS", ActionType::Event},
+    {"Zoom", Zoom, "KeyZ&Ctrl", ActionType::Event},
+  };
+  controller->SetInputBindings(bindings);
+
+  // repeats of held key don't release it
+  backend.Set(InputButton::KEY_SPACE, PressState::JUST_PRESSED, 1.0);
+  backend.Set(InputButton::KEY_SPACE, PressState::PRESSING, 1.5);
+  backend.Set(InputButton::KEY_SPACE, PressState::PRESSING, 1.6);
+  controller->GenerateInputEvents();
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == Jump);
+  backend.Set(InputButton::KEY_SPACE, PressState::RELEASED, 1.7);
+
+  // modifiers which aren't required by binding are ignored
+  backend.Set(InputButton::KEY_LEFT_CONTROL, PressState::JUST_PRESSED, 2.0);
+  backend.Set(InputButton::KEY_S, PressState::JUST_PRESSED | PressState::CTRL, 2.1);
+  controller->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == Save);
+  backend.Set(InputButton::KEY_S, PressState::RELEASED | PressState::CTRL, 2.2);
+  backend.Set(InputButton::KEY_LEFT_CONTROL, PressState::RELEASED, 2.3);
+
+  // required modifier must be held
+  backend.Set(InputButton::KEY_Z, PressState::JUST_PRESSED | PressState::CAPS_LOCK, 3.0);
+  controller->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  backend.Set(InputButton::KEY_Z,
+              PressState::PRESSING | PressState::CTRL | PressState::CAPS_LOCK, 3.1);
+  controller->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == Zoom);
+
+  // hold of keyboard key is repeated by system
+  GetTimeManager().Tick();
+  const double now = GetTimeManager().Timestamp();
+  backend.Set(InputButton::KEY_E, PressState::JUST_PRESSED, now - 2.0);
+  backend.Set(InputButton::KEY_E, PressState::PRESSING, now - 1.5);
+  backend.Set(InputButton::KEY_E, PressState::PRESSING | PressState::SHIFT, now - 1.4);
+  controller->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == Use);
+}
+
+TEST_CASE("Input is polled at fixed rate", "[InputPoller]")
+{
+  FakeWindowsPlugin windows;
+  FakeInputBackend backend;
+  InputQueue queue;
+  auto controller = CreateInputController(backend);
+  controller->BindInputQueue(queue);
+  InputPoller poller(windows, 1000.0);
+  poller.AddController(*controller);
+
+  // bindings come from the game thread
+  std::thread(
+    [&poller]
+    {
+      poller.SetInputBindings({
+        {"Jump", Jump, "KeySpace", ActionType::Event},
+        {"Sprint", Sprint, "KeyLeftShift", ActionType::Continous},
+        {"Look", Look, "MouseDeltaX+MouseDeltaY", ActionType::Axis},
+      });
+    })
+    .join();
+  backend.Set(InputButton::KEY_SPACE, PressState::JUST_PRESSED);
+  backend.Set(InputButton::KEY_LEFT_SHIFT, PressState::JUST_PRESSED);
+  backend.motion = {1.0f, 0.0f, 0.0f}; // every poll moves the mouse
+
+  const auto start = std::chrono::steady_clock::now();
+  poller.Run([&windows] { return windows.polls == 20; });
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  // polls are spread over time, waiting for events between them
+  REQUIRE(elapsed >= std::chrono::milliseconds(15));
+  REQUIRE(windows.waits >= windows.polls - 1);
+  // only events of buttons are generated at polling rate
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == Jump);
+
+  // states are generated once per frame with motion of all polls
+  std::thread([&poller] { poller.GenerateFrameEvents(); }).join();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 2);
+  REQUIRE(std::get<ContinousAction>(events[0]).code == Sprint);
+  // backend accumulates motion of every poll or wait of windows, they're summed
+  REQUIRE(std::get<AxisAction>(events[1]).deltaValue[0] ==
+          static_cast<float>(windows.polls + windows.waits));
+  poller.GenerateFrameEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::holds_alternative<ContinousAction>(events[0]));
+
+  poller.Stop();
+  poller.Run([] { return false; });
+  REQUIRE(windows.polls == 20);
+}
@@ -0,0 +1,140 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <Game/Time.hpp>
+#include <Input/InputRecorder.hpp>
+using namespace GameFramework;
+
+namespace
+{
+std::vector<GameInputEvent> PopEvents(InputQueue & queue)
+{
+  std::vector<GameInputEvent> result;
+  while (auto event = queue.PopEvent())
+    result.push_back(*event);
+  return result;
+}
+
+/// records 3 frames: jump, nothing, sprint and look
+void WriteRecording(const std::filesystem::path & path)
+{
+  InputProducer producer;
+  auto recorder = CreateInputRecorder(path);
+  producer.BindInputQueue(recorder->GetQueue());
+
+  producer.PushInputEvent(EventAction{1, InputDevice::KEYBOARD});
+  recorder->RecordFrame(1.0, 0.016);
+  recorder->RecordFrame(1.016, 0.016);
+  producer.PushInputEvent(ContinousAction{2, InputDevice::KEYBOARD, 1.01, 0.02});
+  producer.PushInputEvent(AxisAction{3, InputDevice::MOUSE, {10.0f, 20.0f, 0.0f}, {1.0f, 2.0f}});
+  recorder->RecordFrame(1.032, 0.016);
+}
+} // namespace
+
+TEST_CASE("Recorded input is replayed frame by frame", "[InputRecorder]")
+{
+  const auto path = std::filesystem::temp_directory_path() / "GameFramework_Test_Input.bin";
+  WriteRecording(path);
+
+  InputQueue queue;
+  auto replay = CreateInputReplayController(path, 0.0);
+  replay->BindInputQueue(queue);
+  REQUIRE(!replay->IsFinished());
+
+  replay->GenerateInputEvents();
+  auto events = PopEvents(queue);
+  REQUIRE(events.size() == 1);
+  REQUIRE(std::get<EventAction>(events[0]).code == 1);
+  REQUIRE(replay->GetFrameTime() == 1.0);
+  REQUIRE(replay->GetFrameDelta() == 0.016);
+
+  replay->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  REQUIRE(!replay->IsFinished());
+  REQUIRE(replay->GetFrameDelta() == 0.016);
+
+  replay->GenerateInputEvents();
+  events = PopEvents(queue);
+  REQUIRE(events.size() == 2);
+  auto && sprint = std::get<ContinousAction>(events[0]);
+  REQUIRE(sprint.activeStart == 1.01);
+  REQUIRE(sprint.activeDuration == 0.02);
+  auto && look = std::get<AxisAction>(events[1]);
+  REQUIRE(look.device == InputDevice::MOUSE);
+  REQUIRE(look.axisValue[1] == 20.0f);
+  REQUIRE(look.deltaValue[0] == 1.0f);
+  REQUIRE(replay->IsFinished());
+
+  replay->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).empty());
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Timed replay reports deltas of all frames played at once", "[InputRecorder]")
+{
+  const auto path = std::filesystem::temp_directory_path() / "GameFramework_Test_Input.bin";
+  WriteRecording(path);
+
+  InputQueue queue;
+  auto replay = CreateInputReplayController(path, 1000.0);
+  replay->BindInputQueue(queue);
+
+  GetTimeManager().Tick();
+  replay->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).size() == 1);
+  REQUIRE(replay->GetFrameDelta() == 0.016);
+
+  // 1ms of replay is 1s of recording, so the rest of frames is played by one call
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  GetTimeManager().Tick();
+  replay->GenerateInputEvents();
+  REQUIRE(PopEvents(queue).size() == 2);
+  REQUIRE(replay->GetFrameDelta() == Catch::Approx(0.032));
+  REQUIRE(replay->IsFinished());
+
+  replay->GenerateInputEvents();
+  REQUIRE(replay->GetFrameDelta() == 0.0);
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Truncated recording finishes replay", "[InputRecorder]")
+{
+  const auto path = std::filesystem::temp_directory_path() / "GameFramework_Test_Input.bin";
+  WriteRecording(path);
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+
+  InputQueue queue;
+  auto replay = CreateInputReplayController(path, 0.0);
+  replay->BindInputQueue(queue);
+  for (int i = 0; i < 3; ++i)
+    replay->GenerateInputEvents();
+  REQUIRE(replay->IsFinished());
+  REQUIRE(PopEvents(queue).size() == 1);
+
+  {
+    // count of events of the first frame is bigger than the rest of the file
+    WriteRecording(path);
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(4 + sizeof(uint32_t) + 2 * sizeof(double));
+    const uint32_t eventsCount = 0xFFFFFFFF;
+    file.write(reinterpret_cast<const char *>(&eventsCount), sizeof(eventsCount));
+  }
+  replay = CreateInputReplayController(path, 0.0);
+  replay->BindInputQueue(queue);
+  replay->GenerateInputEvents();
+  REQUIRE(replay->IsFinished());
+  REQUIRE(PopEvents(queue).empty());
+
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file << "not a recording";
+  }
+  REQUIRE_THROWS_AS(CreateInputReplayController(path), std::runtime_error);
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,109 @@
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <Render/InstanceBatch.hpp>
+using namespace GameFramework;
+
+namespace
+{
+struct Transform
+{
+  float m[16] = {};
+};
+
+std::vector<Transform> MakeTransforms(size_t count)
+{
+  std::vector<Transform> result(count);
+  for (size_t i = 0; i < count; ++i)
+    result[i].m[12] = static_cast<float>(i);
+  return result;
+}
+} // namespace
+
+TEST_CASE("InstanceBatch tracks changed range", "[InstanceBatch]")
+{
+  InstanceBatch<Transform> batch;
+  auto transforms = MakeTransforms(100);
+
+  batch.Assign(transforms);
+  REQUIRE(batch.Commit());
+  REQUIRE(batch.GetDirtyRange().first == 0);
+  REQUIRE(batch.GetDirtyRange().last == 100);
+  REQUIRE(batch.GetCapacity() == 128);
+  batch.MarkUploaded();
+
+  batch.Assign(transforms);
+  REQUIRE_FALSE(batch.Commit());
+  REQUIRE_FALSE(batch.IsDirty());
+
+  transforms[10].m[13] = 1.0f;
+  transforms[20].m[13] = 1.0f;
+  batch.Assign(transforms);
+  REQUIRE(batch.Commit());
+  REQUIRE(batch.GetDirtyRange().first == 10);
+  REQUIRE(batch.GetDirtyRange().last == 21);
+  batch.MarkUploaded();
+
+  transforms.push_back(Transform{});
+  batch.Assign(transforms);
+  REQUIRE(batch.Commit());
+  REQUIRE(batch.GetDirtyRange().first == 100);
+  REQUIRE(batch.GetDirtyRange().last == 101);
+  batch.MarkUploaded();
+
+  transforms.resize(50);
+  batch.Assign(transforms);
+  REQUIRE(batch.Commit());
+  REQUIRE_FALSE(batch.IsDirty());
+  REQUIRE(batch.Size() == 50);
+  REQUIRE(batch.GetCapacity() == 128);
+}
+
+TEST_CASE("InstanceBatch accumulates dirty range until upload", "[InstanceBatch]")
+{
+  InstanceBatch<Transform> batch;
+  auto transforms = MakeTransforms(10);
+  batch.Assign(transforms);
+  batch.Commit();
+  batch.MarkUploaded();
+
+  transforms[2].m[0] = 2.0f;
+  batch.Assign(transforms);
+  batch.Commit();
+  transforms[7].m[0] = 2.0f;
+  batch.Assign(transforms);
+  batch.Commit();
+  REQUIRE(batch.GetDirtyRange().first == 2);
+  REQUIRE(batch.GetDirtyRange().last == 8);
+}
+
+TEST_CASE("InstanceBatch packing", "[InstanceBatch][!benchmark]")
+{
+  constexpr size_t count = 10000;
+  auto transforms = MakeTransforms(count);
+  InstanceBatch<Transform> batch;
+
+  BENCHMARK("push and commit unchanged")
+  {
+    batch.Clear();
+    for (auto && m : transforms)
+      batch.Push(m);
+    return batch.Commit();
+  };
+
+  BENCHMARK("assign and commit unchanged")
+  {
+    batch.Assign(transforms);
+    return batch.Commit();
+  };
+
+  BENCHMARK("assign and commit with one change")
+  {
+    transforms[count / 2].m[0] += 1.0f;
+    batch.Assign(transforms);
+    const bool changed = batch.Commit();
+    batch.MarkUploaded();
+    return changed;
+  };
+}
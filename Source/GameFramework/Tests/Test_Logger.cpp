@@ -0,0 +1,206 @@
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <Utility/LogCategory.hpp>
+#include <Utility/Logger.hpp>
+using namespace GameFramework;
+
+namespace
+{
+enum class TestEnum
+{
+  Value = 7
+};
+
+/// sink which stores messages, shared with the test because logger owns sinks
+struct CapturedMessages
+{
+  std::mutex mutex;
+  std::vector<LogRecord> records;
+
+  std::vector<LogRecord> Take()
+  {
+    FlushLog();
+    std::lock_guard lk{mutex};
+    return std::move(records);
+  }
+};
+
+struct CaptureSink final : public LogSink
+{
+  explicit CaptureSink(std::shared_ptr<CapturedMessages> messages)
+    : m_messages(std::move(messages))
+  {
+  }
+
+  virtual void Write(std::span<const LogRecord> records) override
+  {
+    std::lock_guard lk{m_messages->mutex};
+    m_messages->records.insert(m_messages->records.end(), records.begin(), records.end());
+  }
+
+private:
+  std::shared_ptr<CapturedMessages> m_messages;
+};
+
+std::shared_ptr<CapturedMessages> GetCapturedMessages()
+{
+  static auto s_messages = []
+  {
+    // console sink is replaced, so tests don't flood the output
+    auto messages = std::make_shared<CapturedMessages>();
+    ClearLogSinks();
+    AddLogSink(std::make_unique<CaptureSink>(messages));
+    return messages;
+  }();
+  s_messages->Take();
+  return s_messages;
+}
+} // namespace
+
+TEST_CASE("Log formats arguments on logger thread", "[Logger]")
+{
+  auto messages = GetCapturedMessages();
+  std::string narrow = "narrow";
+  const char * cstr = "cstr";
+  std::filesystem::path path = "dir/file.txt";
+  Log(LogMessageType::Info, "int ", 42, ", float ", 1.5f, ", ", narrow, ", ", cstr, ", ",
+      std::wstring(L"wide"), ", enum ", TestEnum::Value, ", char ", 'c');
+  Log(LogMessageType::Warning, path);
+  Log(LogMessageType::Error);
+
+  auto records = messages->Take();
+  REQUIRE(records.size() == 3);
+  REQUIRE(records[0].type == LogMessageType::Info);
+  REQUIRE(records[0].message ==
+          L"int 42, float 1.5, narrow, cstr, wide, enum 7, char c");
+  REQUIRE(records[1].type == LogMessageType::Warning);
+  REQUIRE(records[1].message.find(L"file.txt") != std::wstring::npos);
+  REQUIRE(records[2].message.empty());
+}
+
+TEST_CASE("Log filters messages by level", "[Logger]")
+{
+  auto messages = GetCapturedMessages();
+  SetLogLevel(LogMessageType::Warning);
+  Log(LogMessageType::Debug, "debug");
+  Log(LogMessageType::Info, "info");
+  Log(LogMessageType::Warning, "warning");
+  Log(LogMessageType::Error, "error");
+  SetLogLevel(LogMessageType::Debug);
+
+  auto records = messages->Take();
+  REQUIRE(records.size() == 2);
+  REQUIRE(records[0].message == L"warning");
+  REQUIRE(records[1].message == L"error");
+}
+
+TEST_CASE("Log keeps messages of every thread", "[Logger]")
+{
+  auto messages = GetCapturedMessages();
+  constexpr int ThreadsCount = 4;
+  constexpr int MessagesCount = 100;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < ThreadsCount; ++t)
+    threads.emplace_back(
+      [t]
+      {
+        for (int i = 0; i < MessagesCount; ++i)
+          Log(LogMessageType::Info, t, " ", i);
+      });
+  for (auto && thread : threads)
+    thread.join();
+
+  auto records = messages->Take();
+  REQUIRE(records.size() == ThreadsCount * MessagesCount);
+  // messages of one thread are in order
+  std::vector<int> next(ThreadsCount, 0);
+  for (auto && record : records)
+  {
+    const int t = std::stoi(record.message);
+    REQUIRE(record.message == std::to_wstring(t) + L" " + std::to_wstring(next[t]++));
+  }
+}
+
+TEST_CASE("Log writes big messages", "[Logger]")
+{
+  auto messages = GetCapturedMessages();
+  const std::string big(details::MaxDeferredArgsSize * 2, 'x');
+  Log(LogMessageType::Info, big);
+  auto records = messages->Take();
+  REQUIRE(records.size() == 1);
+  REQUIRE(records[0].message.size() == big.size());
+}
+
+TEST_CASE("Log categories are configured by name", "[Logger]")
+{
+  auto messages = GetCapturedMessages();
+  LogCategory render("TestRender");
+  LogCategory renderOfOtherModule("TestRender");
+  ConfigureLogCategories("TestRender = warning; TestAudio=off, broken");
+  LogCategory audio("TestAudio");
+
+  Log(render, LogMessageType::Info, "info");
+  Log(renderOfOtherModule, LogMessageType::Error, "error");
+  Log(audio, LogMessageType::Error, "audio");
+  audio.SetEnabled(true);
+  Log(audio, LogMessageType::Debug, "audio");
+  ConfigureLogCategories("TestRender=on,TestAudio=on");
+
+  auto records = messages->Take();
+  REQUIRE(records.size() == 3);
+  REQUIRE(records[0].message.find(L"broken") != std::wstring::npos);
+  REQUIRE(records[1].message == L"[TestRender] error");
+  REQUIRE(records[2].message == L"[TestAudio] audio");
+}
+
+TEST_CASE("Log call site is sampled and rate limited", "[Logger]")
+{
+  auto messages = GetCapturedMessages();
+  LogCategory category("TestSampled");
+  for (int i = 0; i < 10; ++i)
+    LOG_SAMPLED(category, LogMessageType::Info, 4, "sampled ", i);
+  for (int i = 0; i < 10; ++i)
+    LOG_RATE_LIMITED(category, LogMessageType::Info, 3600.0, "limited ", i);
+
+  LogRateLimiter limiter(0.0);
+  REQUIRE(limiter.TryAcquire() == 1);
+  LogRateLimiter slowLimiter(3600.0);
+  REQUIRE(slowLimiter.TryAcquire() == 1);
+  REQUIRE(slowLimiter.TryAcquire() == 0);
+  REQUIRE(slowLimiter.TryAcquire() == 0);
+
+  auto records = messages->Take();
+  REQUIRE(records.size() == 4);
+  REQUIRE(records[0].message == L"[TestSampled] sampled 0");
+  REQUIRE(records[1].message == L"[TestSampled] sampled 4 [repeated 4 times]");
+  REQUIRE(records[2].message == L"[TestSampled] sampled 8 [repeated 4 times]");
+  REQUIRE(records[3].message == L"[TestSampled] limited 0");
+}
+
+TEST_CASE("Log hot path", "[Logger][!benchmark]")
+{
+  GetCapturedMessages();
+  SetLogLevel(LogMessageType::Info);
+  BENCHMARK("filtered out")
+  {
+    Log(LogMessageType::Debug, "value - ", 42);
+  };
+  SetLogLevel(LogMessageType::Debug);
+  BENCHMARK("deferred")
+  {
+    Log(LogMessageType::Debug, "value - ", 42, ", ", 1.5);
+  };
+  LogCategory category("TestBenchmark");
+  BENCHMARK("rate limited")
+  {
+    LOG_RATE_LIMITED(category, LogMessageType::Debug, 3600.0, "value - ", 42);
+  };
+  GetCapturedMessages();
+}
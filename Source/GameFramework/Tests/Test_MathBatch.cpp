@@ -0,0 +1,146 @@
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <Game/MathBatch.hpp>
+using namespace GameFramework;
+
+namespace
+{
+constexpr SimdLevel s_levels[] = {SimdLevel::SSE, SimdLevel::AVX, SimdLevel::NEON};
+
+/// deterministic values in [-2, 2)
+float NextValue(unsigned & seed)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * 4.0f - 2.0f;
+}
+
+std::vector<float> MakeValues(size_t count, unsigned seed)
+{
+  std::vector<float> values(count);
+  for (auto && v : values)
+    v = NextValue(seed);
+  return values;
+}
+
+template<typename T>
+std::vector<T> MakeStructs(size_t count, unsigned seed)
+{
+  std::vector<T> result(count);
+  auto * values = reinterpret_cast<float *>(result.data());
+  for (size_t i = 0; i < count * sizeof(T) / sizeof(float); ++i)
+    values[i] = NextValue(seed);
+  return result;
+}
+
+template<typename T>
+void RequireEqual(const std::vector<T> & expected, const std::vector<T> & actual)
+{
+  constexpr size_t floatsCount = sizeof(T) / sizeof(float);
+  REQUIRE(expected.size() == actual.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    const auto * e = reinterpret_cast<const float *>(&expected[i]);
+    const auto * a = reinterpret_cast<const float *>(&actual[i]);
+    for (size_t j = 0; j < floatsCount; ++j)
+      REQUIRE(a[j] == Catch::Approx(e[j]).margin(1e-5));
+  }
+}
+} // namespace
+
+TEST_CASE("Batched math computes known values", "[MathBatch]")
+{
+  const SimdLevel detected = GetSimdLevel();
+  REQUIRE(SetSimdLevel(SimdLevel::Scalar));
+  Mat4f translate;
+  translate.m[12] = 1.0f;
+  translate.m[13] = 2.0f;
+  translate.m[14] = 3.0f;
+  Mat4f scale;
+  scale.m[0] = scale.m[5] = scale.m[10] = 2.0f;
+
+  std::vector<Mat4f> result(1);
+  MultiplyMatrices(translate, std::span(&scale, 1), result);
+  std::vector<Vec4f> point{{1.0f, 1.0f, 1.0f, 1.0f}};
+  TransformVectors(result[0], point, point);
+  REQUIRE(point[0].x == 3.0f);
+  REQUIRE(point[0].y == 4.0f);
+  REQUIRE(point[0].z == 5.0f);
+  REQUIRE(point[0].w == 1.0f);
+
+  // rotation by 90 degrees around z swaps extents of x and y
+  Mat4f rotate;
+  rotate.m[0] = 0.0f;
+  rotate.m[1] = 1.0f;
+  rotate.m[4] = -1.0f;
+  rotate.m[5] = 0.0f;
+  std::vector<AABBf> boxes{{{0.0f, 0.0f, 0.0f}, {2.0f, 1.0f, 1.0f}}};
+  TransformAABBs(rotate, boxes, boxes);
+  REQUIRE(boxes[0].min.x == -1.0f);
+  REQUIRE(boxes[0].max.x == 0.0f);
+  REQUIRE(boxes[0].min.y == 0.0f);
+  REQUIRE(boxes[0].max.y == 2.0f);
+  REQUIRE(SetSimdLevel(detected));
+}
+
+TEST_CASE("Batched math gives the same results with every instruction set", "[MathBatch]")
+{
+  const SimdLevel detected = GetSimdLevel();
+  constexpr size_t count = 19; // not a multiple of vector width, so tails are checked too
+  const auto lhs = MakeStructs<Mat4f>(count, 1);
+  const auto rhs = MakeStructs<Mat4f>(count, 2);
+  const auto vectors = MakeStructs<Vec4f>(count, 3);
+  const auto boxes = MakeStructs<AABBf>(count, 4);
+  const auto a = MakeValues(count * 3, 5);
+  const auto b = MakeValues(count * 3, 6);
+  const ConstVec3fSoA aSoA{std::span(a).subspan(0, count), std::span(a).subspan(count, count),
+                           std::span(a).subspan(count * 2, count)};
+  const ConstVec3fSoA bSoA{std::span(b).subspan(0, count), std::span(b).subspan(count, count),
+                           std::span(b).subspan(count * 2, count)};
+
+  struct Results
+  {
+    std::vector<Mat4f> products = std::vector<Mat4f>(count);
+    std::vector<Mat4f> sameLhsProducts = std::vector<Mat4f>(count);
+    std::vector<Vec4f> vectors = std::vector<Vec4f>(count);
+    std::vector<AABBf> boxes = std::vector<AABBf>(count);
+    std::vector<float> dots = std::vector<float>(count);
+    std::vector<float> crosses = std::vector<float>(count * 3);
+  };
+  auto compute = [&](Results & r)
+  {
+    MultiplyMatrices(lhs, rhs, r.products);
+    MultiplyMatrices(lhs[0], rhs, r.sameLhsProducts);
+    TransformVectors(lhs[0], vectors, r.vectors);
+    TransformAABBs(lhs[0], boxes, r.boxes);
+    Dot(aSoA, bSoA, r.dots);
+    auto crosses = std::span(r.crosses);
+    Cross(aSoA, bSoA,
+          Vec3fSoA{crosses.subspan(0, count), crosses.subspan(count, count),
+                   crosses.subspan(count * 2, count)});
+  };
+
+  Results expected;
+  REQUIRE(SetSimdLevel(SimdLevel::Scalar));
+  compute(expected);
+  for (auto level : s_levels)
+  {
+    if (!SetSimdLevel(level))
+      continue;
+    Results actual;
+    compute(actual);
+    RequireEqual(expected.products, actual.products);
+    RequireEqual(expected.sameLhsProducts, actual.sameLhsProducts);
+    RequireEqual(expected.vectors, actual.vectors);
+    RequireEqual(expected.boxes, actual.boxes);
+    RequireEqual(expected.dots, actual.dots);
+    RequireEqual(expected.crosses, actual.crosses);
+
+    // result can be the same span as argument
+    auto inPlace = rhs;
+    MultiplyMatrices(lhs, inPlace, inPlace);
+    RequireEqual(expected.products, inPlace);
+  }
+  REQUIRE(SetSimdLevel(detected));
+}
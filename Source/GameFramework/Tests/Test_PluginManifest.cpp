@@ -0,0 +1,60 @@
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <Plugin/PluginManifest.hpp>
+using namespace GameFramework;
+
+TEST_CASE("Plugin manifest is parsed", "[PluginManifest]")
+{
+  auto manifest = ParsePluginManifest("# render plugin\n"
+                                      "name = RenderPlugin_RHI\n"
+                                      "version = 1.2 # comment\n"
+                                      "\n"
+                                      "dependencies = GlfwWindowPlugin, Assets,\n");
+  REQUIRE(manifest.name == "RenderPlugin_RHI");
+  REQUIRE(manifest.version == "1.2");
+  REQUIRE(manifest.dependencies == std::vector<std::string>{"GlfwWindowPlugin", "Assets"});
+  REQUIRE(manifest.entryPoint == "CreateInstance(GameFramework::IPluginLoader const &)");
+
+  REQUIRE(ParsePluginManifest("entry=Create").entryPoint == "Create");
+  REQUIRE_THROWS_AS(ParsePluginManifest("name"), std::runtime_error);
+  REQUIRE_THROWS_AS(ParsePluginManifest("author = me"), std::runtime_error);
+}
+
+TEST_CASE("Plugin without manifest is named by its file", "[PluginManifest]")
+{
+  const auto path = std::filesystem::temp_directory_path() / "GameFramework_TestPlugin";
+  std::filesystem::remove(std::filesystem::path(path).concat(".plugin"));
+  auto manifest = ReadPluginManifest(path);
+  REQUIRE(manifest.name == "GameFramework_TestPlugin");
+  REQUIRE(manifest.dependencies.empty());
+
+  {
+    std::ofstream file(std::filesystem::path(path).concat(".plugin"));
+    file << "name = Game\nversion = 2\n";
+  }
+  manifest = ReadPluginManifest(path);
+  REQUIRE(manifest.name == "Game");
+  REQUIRE(manifest.version == "2");
+  std::filesystem::remove(std::filesystem::path(path).concat(".plugin"));
+}
+
+TEST_CASE("Plugins are loaded after their dependencies", "[PluginManifest]")
+{
+  std::vector<PluginManifest> manifests(4);
+  manifests[0] = {"Game", "", {"Render", "Windows"}};
+  manifests[1] = {"Windows"};
+  manifests[2] = {"Render", "", {"Windows"}};
+  manifests[3] = {"Audio"};
+
+  auto stages = SortPluginsByDependencies(manifests);
+  REQUIRE(stages == std::vector<std::vector<size_t>>{{1, 3}, {2}, {0}});
+
+  manifests[1].dependencies = {"Game"};
+  REQUIRE_THROWS_AS(SortPluginsByDependencies(manifests), std::runtime_error);
+  manifests[1].dependencies = {"Physics"};
+  REQUIRE_THROWS_AS(SortPluginsByDependencies(manifests), std::runtime_error);
+}
@@ -0,0 +1,114 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+#include <Utility/Profiler.hpp>
+using namespace GameFramework;
+
+namespace
+{
+std::string ExportTrace()
+{
+  const auto path = std::filesystem::temp_directory_path() / "GameFramework_Test_Profiler.json";
+  REQUIRE(GetProfiler().ExportChromeTrace(path));
+  std::ifstream file(path);
+  std::stringstream content;
+  content << file.rdbuf();
+  file.close();
+  std::filesystem::remove(path);
+  return content.str();
+}
+} // namespace
+
+TEST_CASE("Profiler collects zones of all threads during capture", "[Profiler]")
+{
+  {
+    ProfileZone zone("ZoneBeforeCapture");
+  }
+  GetProfiler().BeginCapture();
+  REQUIRE(GetProfiler().IsCapturing());
+  {
+    ProfileZone outer("OuterZone");
+    ProfileZone inner("InnerZone");
+  }
+  std::thread worker(
+    []
+    {
+      GetProfiler().SetThreadName("TestWorker");
+      ProfileZone zone("WorkerZone");
+    });
+  worker.join();
+  GetProfiler().EndCapture();
+  {
+    ProfileZone zone("ZoneAfterCapture");
+  }
+
+  const std::string trace = ExportTrace();
+  REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+  REQUIRE(trace.find("OuterZone") != std::string::npos);
+  REQUIRE(trace.find("InnerZone") != std::string::npos);
+  REQUIRE(trace.find("WorkerZone") != std::string::npos);
+  REQUIRE(trace.find("TestWorker") != std::string::npos);
+  REQUIRE(trace.find("ZoneBeforeCapture") == std::string::npos);
+  REQUIRE(trace.find("ZoneAfterCapture") == std::string::npos);
+  REQUIRE(GetProfiler().GetDroppedZonesCount() == 0);
+}
+
+TEST_CASE("New capture drops zones of previous one", "[Profiler]")
+{
+  GetProfiler().BeginCapture();
+  {
+    ProfileZone zone("FirstCapture");
+  }
+  GetProfiler().EndCapture();
+  GetProfiler().BeginCapture();
+  {
+    ProfileZone zone("SecondCapture");
+  }
+  GetProfiler().EndCapture();
+
+  const std::string trace = ExportTrace();
+  REQUIRE(trace.find("FirstCapture") == std::string::npos);
+  REQUIRE(trace.find("SecondCapture") != std::string::npos);
+}
+
+TEST_CASE("Thread name is registered with the first zone and escaped in trace", "[Profiler]")
+{
+  GetProfiler().BeginCapture();
+  std::thread idle([] { GetProfiler().SetThreadName("IdleWorker"); });
+  idle.join();
+  std::thread worker(
+    []
+    {
+      GetProfiler().SetThreadName("Quoted \"Worker\"");
+      ProfileZone zone("Zone \\ with \"quotes\"");
+    });
+  worker.join();
+  GetProfiler().EndCapture();
+
+  const std::string trace = ExportTrace();
+  REQUIRE(trace.find("IdleWorker") == std::string::npos);
+  REQUIRE(trace.find(R"("Quoted \"Worker\"")") != std::string::npos);
+  REQUIRE(trace.find(R"("Zone \\ with \"quotes\"")") != std::string::npos);
+}
+
+TEST_CASE("Zone names are interned and outlive their source", "[Profiler]")
+{
+  std::string name = "DynamicZone";
+  const char * interned = InternProfileZoneName(name);
+  name = "Overwritten";
+  REQUIRE(std::string(interned) == "DynamicZone");
+  REQUIRE(InternProfileZoneName(std::string("DynamicZone")) == interned);
+
+#ifdef GAME_FRAMEWORK_PROFILING
+  GetProfiler().BeginCapture();
+  {
+    PROFILE_ZONE(std::string("MacroZone").c_str());
+  }
+  GetProfiler().EndCapture();
+  REQUIRE(ExportTrace().find("\"MacroZone\"") != std::string::npos);
+#endif
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+#include <Input/StaticBinding.hpp>
+using namespace GameFramework;
+
+namespace
+{
+constexpr auto s_jump = ParseStaticBinding("KeySpace; GamepadA");
+constexpr auto s_move =
+  ParseStaticBinding("KeyW+KeyLeftShift&Ctrl; GamepadLeftStickX+GamepadLeftStickY");
+constexpr auto s_look = ParseStaticBinding("MouseCursorX+MouseCursorY");
+constexpr auto s_save = ParseStaticBinding("KeyLeftCtrl > KeyS(1s); KeyF5 >> KeyF5(200ms)");
+
+template<typename FuncT>
+constexpr bool ParsesWithoutErrors(std::string_view str, FuncT && onCondition)
+{
+  bool ok = true;
+  details::ParseBindingConditions(str, onCondition,
+                                  [&ok](LogMessageType, const char *, std::string_view)
+                                  { ok = false; });
+  return ok;
+}
+
+constexpr bool IsValidBinding(std::string_view str)
+{
+  return ParsesWithoutErrors(str, [](const BindingCondition &) {});
+}
+} // namespace
+
+static_assert(s_jump.count == 2);
+static_assert(s_jump.conditions[0].device == InputDevice::KEYBOARD);
+static_assert(s_jump.conditions[0].chordSize == 1);
+static_assert(s_jump.conditions[0].chord[0].first == InputButton::KEY_SPACE);
+static_assert(s_jump.conditions[0].chord[0].second == PressState::JUST_PRESSED);
+static_assert(s_jump.conditions[1].device == InputDevice::ANY_JOYSTICK);
+static_assert(s_jump.conditions[1].chord[0].first == InputButton::GAMEPAD_BUTTON_A);
+
+static_assert(s_move.count == 2);
+static_assert(!s_move.conditions[0].isAxis);
+static_assert(s_move.conditions[0].chordSize == 2);
+static_assert(s_move.conditions[0].chord[1].first == InputButton::KEY_LEFT_SHIFT);
+static_assert(s_move.conditions[0].chord[1].second ==
+              (PressState::JUST_PRESSED | PressState::CTRL));
+static_assert(s_move.conditions[1].isAxis);
+static_assert(s_move.conditions[1].axes[1] == InputAxis::GAMEPAD_LEFT_STICK_Y);
+static_assert(s_move.conditions[1].axes[2] == InputAxis::UNKNOWN);
+
+static_assert(s_look.count == 1 && s_look.conditions[0].device == InputDevice::MOUSE);
+
+static_assert(s_save.count == 4);
+static_assert(s_save.conditions[0].isSequenceStep && s_save.conditions[0].maxDelay == 0.0f);
+static_assert(s_save.conditions[1].isSequenceStep && s_save.conditions[1].maxDelay == 0.5f);
+static_assert(s_save.conditions[1].holdTime == 1.0f);
+static_assert(s_save.conditions[2].maxDelay == 0.0f && s_save.conditions[2].holdTime == 0.0f);
+static_assert(s_save.conditions[3].maxDelay == 1.0f && s_save.conditions[3].holdTime == 0.2f);
+
+static_assert(!IsValidBinding("KeyQ+Unknown"));
+static_assert(!IsValidBinding("KeyA+GamepadA"));
+static_assert(!IsValidBinding("KeyA;"));
+static_assert(!IsValidBinding("KeyA+KeyB+KeyC+KeyD+KeyE"));
+static_assert(!IsValidBinding("KeyA > GamepadA"));
+static_assert(!IsValidBinding("KeyA(1h)"));
+static_assert(!IsValidBinding("KeyA > "));
+static_assert(!IsValidBinding("KeyA>KeyA>KeyA>KeyA>KeyA>KeyA>KeyA>KeyA>KeyA"));
+
+TEST_CASE("Static binding matches runtime parsing", "[StaticBinding]")
+{
+  const std::string binding = "KeyW+KeyLeftShift&Ctrl; GamepadLeftStickX+GamepadLeftStickY";
+  std::vector<BindingCondition> runtime;
+  REQUIRE(ParsesWithoutErrors(binding, [&runtime](const BindingCondition & condition)
+                              { runtime.push_back(condition); }));
+  const auto conditions = s_move.GetConditions();
+  REQUIRE(runtime.size() == conditions.size());
+  for (size_t i = 0; i < runtime.size(); ++i)
+  {
+    REQUIRE(runtime[i].device == conditions[i].device);
+    REQUIRE(runtime[i].isAxis == conditions[i].isAxis);
+    REQUIRE(runtime[i].axes == conditions[i].axes);
+    REQUIRE(runtime[i].chordSize == conditions[i].chordSize);
+    REQUIRE(runtime[i].chord == conditions[i].chord);
+  }
+}
+
+TEST_CASE("Names are looked up in sorted tables", "[StaticBinding]")
+{
+  REQUIRE(std::ranges::is_sorted(details::s_sortedButtonsNames, {},
+                                 [](auto && entry) { return entry.first; }));
+  REQUIRE(details::FindByName(details::s_sortedButtonsNames, "KeyF12") == InputButton::KEY_F12);
+  REQUIRE(details::FindByName(details::s_sortedAxesNames, "GamepadR2") ==
+          InputAxis::GAMEPAD_RIGHT_TRIGGER);
+  REQUIRE(!details::FindByName(details::s_sortedButtonsNames, "KeyF13"));
+}
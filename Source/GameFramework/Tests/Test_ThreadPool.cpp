@@ -0,0 +1,42 @@
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <Game/ThreadPool.hpp>
+using namespace GameFramework;
+
+TEST_CASE("ParallelFor calls every index once", "[ThreadPool]")
+{
+  std::vector<std::atomic<int>> calls(1000);
+  GetThreadPool().ParallelFor(calls.size(), [&calls](size_t i) { calls[i]++; });
+  for (auto && c : calls)
+    REQUIRE(c == 1);
+
+  GetThreadPool().ParallelFor(0, [](size_t) { FAIL("must not be called"); });
+}
+
+TEST_CASE("ParallelFor rethrows exception of task", "[ThreadPool]")
+{
+  std::atomic<size_t> calls = 0;
+  REQUIRE_THROWS_AS(GetThreadPool().ParallelFor(10,
+                                                [&calls](size_t i)
+                                                {
+                                                  calls++;
+                                                  if (i == 5)
+                                                    throw std::runtime_error("task failed");
+                                                }),
+                    std::runtime_error);
+  REQUIRE(calls == 10);
+}
+
+TEST_CASE("Enqueued task is executed", "[ThreadPool]")
+{
+  auto promise = std::make_shared<std::promise<std::thread::id>>();
+  auto future = promise->get_future();
+  GetThreadPool().Enqueue([promise] { promise->set_value(std::this_thread::get_id()); });
+  REQUIRE(future.get() != std::this_thread::get_id());
+}
@@ -0,0 +1,127 @@
+#include <vector>
+
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <Game/TransformHierarchy.hpp>
+using namespace GameFramework;
+
+namespace
+{
+Transform Translation(float x, float y, float z)
+{
+  Transform t;
+  t.translation = {x, y, z};
+  return t;
+}
+
+void RequirePosition(const Mat4f & m, float x, float y, float z)
+{
+  REQUIRE(m.m[12] == Catch::Approx(x));
+  REQUIRE(m.m[13] == Catch::Approx(y));
+  REQUIRE(m.m[14] == Catch::Approx(z));
+}
+} // namespace
+
+TEST_CASE("Transform matrix applies scale, rotation and translation", "[TransformHierarchy]")
+{
+  // 90 degrees around z
+  Transform t = Translation(1.0f, 2.0f, 3.0f);
+  t.rotation = {0.0f, 0.0f, 0.70710678f, 0.70710678f};
+  t.scale = {2.0f, 1.0f, 1.0f};
+  const Mat4f m = ToMatrix(t);
+  // x axis is scaled and goes to y
+  REQUIRE(m.m[0] == Catch::Approx(0.0f).margin(1e-6));
+  REQUIRE(m.m[1] == Catch::Approx(2.0f));
+  REQUIRE(m.m[4] == Catch::Approx(-1.0f));
+  REQUIRE(m.m[5] == Catch::Approx(0.0f).margin(1e-6));
+  REQUIRE(m.m[10] == Catch::Approx(1.0f));
+  RequirePosition(m, 1.0f, 2.0f, 3.0f);
+}
+
+TEST_CASE("Transform hierarchy updates only changed subtrees", "[TransformHierarchy]")
+{
+  TransformHierarchy hierarchy;
+  const auto root = hierarchy.Create(Translation(1.0f, 0.0f, 0.0f));
+  const auto child = hierarchy.Create(Translation(0.0f, 1.0f, 0.0f), root);
+  const auto grandChild = hierarchy.Create(Translation(0.0f, 0.0f, 1.0f), child);
+  const auto other = hierarchy.Create(Translation(5.0f, 0.0f, 0.0f));
+  REQUIRE(hierarchy.GetSize() == 4);
+  REQUIRE(hierarchy.GetDepth() == 3);
+
+  hierarchy.Update();
+  REQUIRE(hierarchy.GetUpdatedCount() == 4);
+  RequirePosition(hierarchy.GetWorldMatrix(grandChild), 1.0f, 1.0f, 1.0f);
+  RequirePosition(hierarchy.GetWorldMatrix(other), 5.0f, 0.0f, 0.0f);
+
+  hierarchy.Update();
+  REQUIRE(hierarchy.GetUpdatedCount() == 0);
+
+  // moved node is updated with its subtree, other nodes are kept
+  hierarchy.SetLocal(child, Translation(0.0f, 2.0f, 0.0f));
+  hierarchy.SetLocal(grandChild, Translation(0.0f, 0.0f, 3.0f));
+  hierarchy.Update();
+  REQUIRE(hierarchy.GetUpdatedCount() == 2);
+  RequirePosition(hierarchy.GetWorldMatrix(child), 1.0f, 2.0f, 0.0f);
+  RequirePosition(hierarchy.GetWorldMatrix(grandChild), 1.0f, 2.0f, 3.0f);
+
+  SECTION("Reparenting moves subtree to other depth")
+  {
+    REQUIRE_FALSE(hierarchy.SetParent(root, grandChild));
+    REQUIRE(hierarchy.SetParent(child, other));
+    REQUIRE(hierarchy.GetParent(child) == other);
+    hierarchy.Update();
+    REQUIRE(hierarchy.GetUpdatedCount() == 2);
+    RequirePosition(hierarchy.GetWorldMatrix(grandChild), 5.0f, 2.0f, 3.0f);
+
+    REQUIRE(hierarchy.SetParent(child, {}));
+    REQUIRE_FALSE(hierarchy.GetParent(child).IsValid());
+    hierarchy.Update();
+    RequirePosition(hierarchy.GetWorldMatrix(grandChild), 0.0f, 2.0f, 3.0f);
+
+    REQUIRE(hierarchy.SetParent(root, grandChild));
+    hierarchy.Update();
+    REQUIRE(hierarchy.GetDepth() == 3);
+    RequirePosition(hierarchy.GetWorldMatrix(root), 1.0f, 2.0f, 3.0f);
+  }
+
+  SECTION("Destroy removes whole subtree")
+  {
+    hierarchy.Destroy(child);
+    REQUIRE_FALSE(hierarchy.IsAlive(child));
+    REQUIRE_FALSE(hierarchy.IsAlive(grandChild));
+    REQUIRE(hierarchy.IsAlive(root));
+    REQUIRE(hierarchy.GetSize() == 2);
+    REQUIRE(hierarchy.GetDepth() == 1);
+
+    // slot is reused, but old handle stays invalid
+    const auto node = hierarchy.Create(Translation(0.0f, 1.0f, 0.0f), root);
+    REQUIRE(node.index == grandChild.index);
+    REQUIRE_FALSE(hierarchy.IsAlive(grandChild));
+    hierarchy.SetLocal(grandChild, Translation(7.0f, 7.0f, 7.0f));
+    hierarchy.Update();
+    REQUIRE(hierarchy.GetUpdatedCount() == 1);
+    RequirePosition(hierarchy.GetWorldMatrix(node), 1.0f, 1.0f, 0.0f);
+  }
+}
+
+TEST_CASE("Transform hierarchy updates wide levels in parallel", "[TransformHierarchy]")
+{
+  TransformHierarchy hierarchy;
+  const auto root = hierarchy.Create(Translation(0.0f, 0.0f, 1.0f));
+  std::vector<TransformHandle> chains;
+  for (int i = 0; i < 1000; ++i)
+  {
+    const auto node = hierarchy.Create(Translation(static_cast<float>(i), 0.0f, 0.0f), root);
+    chains.push_back(hierarchy.Create(Translation(0.0f, 1.0f, 0.0f), node));
+  }
+  hierarchy.Update();
+  REQUIRE(hierarchy.GetUpdatedCount() == 2001);
+  for (int i = 0; i < 1000; ++i)
+    RequirePosition(hierarchy.GetWorldMatrix(chains[i]), static_cast<float>(i), 1.0f, 1.0f);
+
+  hierarchy.SetLocal(root, Translation(0.0f, 0.0f, 2.0f));
+  hierarchy.Update();
+  REQUIRE(hierarchy.GetUpdatedCount() == 2001);
+  for (int i = 0; i < 1000; ++i)
+    RequirePosition(hierarchy.GetWorldMatrix(chains[i]), static_cast<float>(i), 1.0f, 2.0f);
+}
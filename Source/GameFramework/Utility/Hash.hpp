@@ -0,0 +1,143 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace GameFramework::Utils
+{
+
+namespace details
+{
+// constants of wyhash (public domain)
+inline constexpr uint64_t s_hashSecret[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+                                             0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+/// @brief multiplies two 64-bit values into 128-bit and folds it back with xor
+inline uint64_t Mix(uint64_t a, uint64_t b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+  __uint128_t r = static_cast<__uint128_t>(a) * b;
+  return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  uint64_t hi;
+  uint64_t lo = _umul128(a, b, &hi);
+  return lo ^ hi;
+#else
+  const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a),
+                 lb = static_cast<uint32_t>(b);
+  const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+  const uint64_t t = rl + (rm0 << 32);
+  uint64_t carry = t < rl;
+  const uint64_t lo = t + (rm1 << 32);
+  carry += lo < t;
+  const uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+  return lo ^ hi;
+#endif
+}
+
+inline uint64_t Read64(const std::byte * p) noexcept
+{
+  uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint64_t Read32(const std::byte * p) noexcept
+{
+  uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint64_t Read3(const std::byte * p, size_t len) noexcept
+{
+  return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[len >> 1]) << 8) |
+         static_cast<uint64_t>(p[len - 1]);
+}
+} // namespace details
+
+/// @brief fast non-cryptographic 64-bit hash of raw bytes (wyhash algorithm).
+///        Big buffers are processed by 48-byte blocks in three independent lanes
+inline uint64_t HashBytes(std::span<const std::byte> data, uint64_t seed = 0) noexcept
+{
+  using namespace details;
+  const std::byte * p = data.data();
+  const size_t len = data.size();
+  seed ^= Mix(seed ^ s_hashSecret[0], s_hashSecret[1]);
+
+  uint64_t a = 0, b = 0;
+  if (len <= 16)
+  {
+    if (len >= 4)
+    {
+      const size_t shift = (len >> 3) << 2;
+      a = (Read32(p) << 32) | Read32(p + shift);
+      b = (Read32(p + len - 4) << 32) | Read32(p + len - 4 - shift);
+    }
+    else if (len > 0)
+    {
+      a = Read3(p, len);
+    }
+  }
+  else
+  {
+    size_t i = len;
+    if (i > 48)
+    {
+      uint64_t lane1 = seed, lane2 = seed;
+      do
+      {
+        seed = Mix(Read64(p) ^ s_hashSecret[1], Read64(p + 8) ^ seed);
+        lane1 = Mix(Read64(p + 16) ^ s_hashSecret[2], Read64(p + 24) ^ lane1);
+        lane2 = Mix(Read64(p + 32) ^ s_hashSecret[3], Read64(p + 40) ^ lane2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= lane1 ^ lane2;
+    }
+    while (i > 16)
+    {
+      seed = Mix(Read64(p) ^ s_hashSecret[1], Read64(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = Read64(p + i - 16);
+    b = Read64(p + i - 8);
+  }
+
+  a ^= s_hashSecret[1];
+  b ^= seed;
+#if defined(__SIZEOF_INT128__)
+  __uint128_t r = static_cast<__uint128_t>(a) * b;
+  a = static_cast<uint64_t>(r);
+  b = static_cast<uint64_t>(r >> 64);
+#else
+  const uint64_t folded = Mix(a, b);
+  a = folded;
+  b = folded ^ s_hashSecret[2];
+#endif
+  return Mix(a ^ s_hashSecret[0] ^ len, b ^ s_hashSecret[1]);
+}
+
+/// @brief hash of array of trivially copyable values. The whole array is hashed as one buffer
+template<typename T>
+  requires(std::is_trivially_copyable_v<T>)
+inline uint64_t HashSpan(std::span<const T> values, uint64_t seed = 0) noexcept
+{
+  return HashBytes(std::as_bytes(values), seed);
+}
+
+/// @brief hash of trivially copyable value
+template<typename T>
+  requires(std::is_trivially_copyable_v<T>)
+inline uint64_t HashValue(const T & value, uint64_t seed = 0) noexcept
+{
+  return HashBytes(std::as_bytes(std::span{&value, 1}), seed);
+}
+
+} // namespace GameFramework::Utils
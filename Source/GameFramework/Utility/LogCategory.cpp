@@ -0,0 +1,122 @@
+#include "LogCategory.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <Utility/StringUtils.hpp>
+
+namespace GameFramework
+{
+namespace
+{
+/// severity which disables category
+constexpr int DisabledSeverity = GetSeverity(LogMessageType::Error) + 1;
+
+std::optional<int> ParseSeverity(std::string_view value)
+{
+  std::string lower(value);
+  std::transform(lower.begin(), lower.end(), lower.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  if (lower == "off")
+    return DisabledSeverity;
+  if (lower == "on" || lower == "debug")
+    return GetSeverity(LogMessageType::Debug);
+  if (lower == "info")
+    return GetSeverity(LogMessageType::Info);
+  if (lower == "warning")
+    return GetSeverity(LogMessageType::Warning);
+  if (lower == "error")
+    return GetSeverity(LogMessageType::Error);
+  return std::nullopt;
+}
+
+void ApplySeverity(LogCategory & category, int severity) noexcept
+{
+  constexpr LogMessageType BySeverity[] = {LogMessageType::Debug, LogMessageType::Info,
+                                           LogMessageType::Warning, LogMessageType::Error};
+  if (severity == DisabledSeverity)
+    category.SetEnabled(false);
+  else
+    category.SetLevel(BySeverity[severity]);
+}
+
+struct LogCategoriesRegistry final
+{
+  std::mutex mutex;
+  std::map<std::string, std::vector<LogCategory *>, std::less<>> categories;
+  std::map<std::string, int, std::less<>> configured;
+};
+
+LogCategoriesRegistry & GetRegistry()
+{
+  static LogCategoriesRegistry s_registry;
+  return s_registry;
+}
+} // namespace
+
+LogCategory::LogCategory(std::string_view name, LogMessageType level)
+  : m_name(name)
+  , m_minSeverity(GetSeverity(level))
+{
+  auto && registry = GetRegistry();
+  std::lock_guard lk{registry.mutex};
+  if (auto it = registry.configured.find(name); it != registry.configured.end())
+    ApplySeverity(*this, it->second);
+  registry.categories[std::string(name)].push_back(this);
+}
+
+LogCategory::~LogCategory()
+{
+  auto && registry = GetRegistry();
+  std::lock_guard lk{registry.mutex};
+  if (auto it = registry.categories.find(m_name); it != registry.categories.end())
+    std::erase(it->second, this);
+}
+
+void LogCategory::SetLevel(LogMessageType level) noexcept
+{
+  m_minSeverity.store(GetSeverity(level), std::memory_order_relaxed);
+}
+
+void LogCategory::SetEnabled(bool enabled) noexcept
+{
+  m_minSeverity.store(enabled ? GetSeverity(LogMessageType::Debug) : DisabledSeverity,
+                      std::memory_order_relaxed);
+}
+
+GAME_FRAMEWORK_API void ConfigureLogCategories(std::string_view config)
+{
+  auto && registry = GetRegistry();
+  std::lock_guard lk{registry.mutex};
+  while (!config.empty())
+  {
+    const size_t end = std::min(config.find_first_of(",;"), config.size());
+    const std::string_view entry = config.substr(0, end);
+    config.remove_prefix(std::min(end + 1, config.size()));
+
+    const size_t separator = entry.find('=');
+    const std::string_view name = Utils::Trim(entry.substr(0, separator));
+    const auto severity = separator == std::string_view::npos
+                            ? std::nullopt
+                            : ParseSeverity(Utils::Trim(entry.substr(separator + 1)));
+    if (name.empty() || !severity)
+    {
+      Log(LogMessageType::Warning, "Invalid log category setting - ", Utils::Trim(entry));
+      continue;
+    }
+
+    registry.configured[std::string(name)] = *severity;
+    if (auto it = registry.categories.find(name); it != registry.categories.end())
+    {
+      for (LogCategory * category : it->second)
+        ApplySeverity(*category, *severity);
+    }
+  }
+}
+
+} // namespace GameFramework
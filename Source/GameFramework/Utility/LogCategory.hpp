@@ -0,0 +1,147 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+#include <Utility/Logger.hpp>
+
+namespace GameFramework
+{
+
+/// @brief named group of messages which can be filtered at runtime.
+///        Categories with the same name are configured together, so every module can declare
+///        its own instance
+class GAME_FRAMEWORK_API LogCategory final
+{
+public:
+  /// @param name - must outlive the category (string literal)
+  explicit LogCategory(std::string_view name, LogMessageType level = LogMessageType::Debug);
+  ~LogCategory();
+  LogCategory(const LogCategory &) = delete;
+  LogCategory & operator=(const LogCategory &) = delete;
+
+  std::string_view GetName() const noexcept { return m_name; }
+  bool IsEnabled(LogMessageType type) const noexcept
+  {
+    return GetSeverity(type) >= m_minSeverity.load(std::memory_order_relaxed);
+  }
+  void SetLevel(LogMessageType level) noexcept;
+  void SetEnabled(bool enabled) noexcept;
+
+private:
+  std::string_view m_name;
+  std::atomic<int> m_minSeverity;
+};
+
+/// @brief configure categories by string like "Input=warning, Render=off, Assets=on".
+///        Values: off, on, debug, info, warning, error. Settings are applied to categories
+///        which are created later too
+GAME_FRAMEWORK_API void ConfigureLogCategories(std::string_view config);
+
+/// @brief Log message of the category, it's prefixed with category name
+template<typename... Args>
+inline void Log(const LogCategory & category, LogMessageType type, Args &&... args)
+{
+  if (category.IsEnabled(type))
+    Log(type, '[', category.GetName(), "] ", std::forward<Args>(args)...);
+}
+
+/// @brief state of call site which lets through one message per interval
+class LogRateLimiter final
+{
+  using Clock = std::chrono::steady_clock;
+
+public:
+  explicit LogRateLimiter(double intervalSeconds) noexcept
+    : m_interval(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(intervalSeconds)))
+  {
+  }
+
+  /// @return 0 if message should be suppressed,
+  ///         otherwise count of calls since last logged message including this one
+  uint32_t TryAcquire() noexcept
+  {
+    const auto now = Clock::now().time_since_epoch().count();
+    auto next = m_next.load(std::memory_order_relaxed);
+    if (now < next ||
+        !m_next.compare_exchange_strong(next, now + m_interval.count(), std::memory_order_relaxed))
+    {
+      m_suppressed.fetch_add(1, std::memory_order_relaxed);
+      return 0;
+    }
+    return m_suppressed.exchange(0, std::memory_order_relaxed) + 1;
+  }
+
+private:
+  const Clock::duration m_interval;
+  std::atomic<Clock::rep> m_next = 0;
+  std::atomic<uint32_t> m_suppressed = 0;
+};
+
+/// @brief state of call site which lets through every N-th message
+class LogSampler final
+{
+public:
+  explicit LogSampler(uint32_t period) noexcept
+    : m_period(period > 0 ? period : 1)
+  {
+  }
+
+  /// @return 0 if message should be suppressed,
+  ///         otherwise count of calls since last logged message including this one
+  uint32_t TryAcquire() noexcept
+  {
+    const uint32_t call = m_counter.fetch_add(1, std::memory_order_relaxed);
+    if (call % m_period != 0)
+      return 0;
+    return call == 0 ? 1 : m_period;
+  }
+
+private:
+  const uint32_t m_period;
+  std::atomic<uint32_t> m_counter = 0;
+};
+
+namespace details
+{
+template<typename... Args>
+inline void LogRepeated(const LogCategory & category, LogMessageType type, uint32_t calls,
+                        Args &&... args)
+{
+  if (calls > 1)
+    Log(category, type, std::forward<Args>(args)..., " [repeated ", calls, " times]");
+  else
+    Log(category, type, std::forward<Args>(args)...);
+}
+} // namespace details
+
+} // namespace GameFramework
+
+/// @brief log message of the call site not often than once per interval.
+///        Suppressed calls are counted and reported with the next logged message
+#define LOG_RATE_LIMITED(category, type, intervalSeconds, ...)                                    \
+  do                                                                                              \
+  {                                                                                               \
+    if ((category).IsEnabled(type))                                                               \
+    {                                                                                             \
+      static ::GameFramework::LogRateLimiter s_logLimiter(intervalSeconds);                       \
+      if (const uint32_t calls = s_logLimiter.TryAcquire())                                       \
+        ::GameFramework::details::LogRepeated(category, type, calls, __VA_ARGS__);                \
+    }                                                                                             \
+  } while (false)
+
+/// @brief log every N-th message of the call site
+#define LOG_SAMPLED(category, type, period, ...)                                                  \
+  do                                                                                              \
+  {                                                                                               \
+    if ((category).IsEnabled(type))                                                               \
+    {                                                                                             \
+      static ::GameFramework::LogSampler s_logSampler(period);                                    \
+      if (const uint32_t calls = s_logSampler.TryAcquire())                                       \
+        ::GameFramework::details::LogRepeated(category, type, calls, __VA_ARGS__);                \
+    }                                                                                             \
+  } while (false)
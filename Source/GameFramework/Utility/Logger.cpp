@@ -0,0 +1,404 @@
+#include "Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace GameFramework
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+const wchar_t * GetPrefix(LogMessageType type) noexcept
+{
+  switch (type)
+  {
+    case LogMessageType::Info:
+      return L"INFO: ";
+    case LogMessageType::Warning:
+      return L"WARN: ";
+    case LogMessageType::Error:
+      return L"ERROR: ";
+    case LogMessageType::Debug:
+      return L"DEBUG: ";
+  }
+  return L"";
+}
+
+struct ConsoleLogSink final : public LogSink
+{
+  virtual void Write(std::span<const LogRecord> records) override
+  {
+    for (auto && record : records)
+      std::wcout << GetPrefix(record.type) << record.message << L'\n';
+    std::wcout.flush();
+  }
+};
+
+struct FileLogSink final : public LogSink
+{
+  explicit FileLogSink(const std::filesystem::path & path)
+    : m_file(path, std::ios::app)
+  {
+    if (!m_file)
+      throw std::runtime_error("Failed to open log file - " + path.string());
+  }
+
+  virtual void Write(std::span<const LogRecord> records) override
+  {
+    for (auto && record : records)
+      m_file << GetPrefix(record.type) << record.message << L'\n';
+    m_file.flush();
+  }
+
+private:
+  std::wofstream m_file;
+};
+
+struct alignas(8) RecordHeader final
+{
+  uint32_t size; ///< size of the record with header, multiple of 8
+  LogMessageType type;
+  details::LogFormatFunc format;
+  Clock::time_point time;
+};
+
+constexpr size_t AlignRecordSize(size_t size) noexcept
+{
+  return (size + alignof(RecordHeader) - 1) & ~(alignof(RecordHeader) - 1);
+}
+
+/// SPSC ring of encoded records. Calling thread writes records, logger thread reads them.
+/// Record never wraps around the end of the buffer, the tail of buffer is skipped instead
+class RecordsRing final
+{
+public:
+  static constexpr size_t Capacity = 1 << 16;
+  static_assert(details::MaxDeferredArgsSize + sizeof(RecordHeader) < Capacity / 4);
+
+  std::byte * Acquire(size_t size) noexcept
+  {
+    const uint64_t head = m_head.load(std::memory_order_acquire);
+    uint64_t tail = m_tail.load(std::memory_order_relaxed);
+    const size_t untilEnd = Capacity - tail % Capacity;
+    const size_t required = size > untilEnd ? size + untilEnd : size;
+    if (Capacity - (tail - head) < required)
+      return nullptr;
+    if (size > untilEnd)
+    {
+      SkipTail(tail);
+      tail += untilEnd;
+    }
+    m_acquired = size;
+    m_acquiredTail = tail;
+    return &m_buffer[tail % Capacity];
+  }
+
+  void Commit() noexcept
+  {
+    m_tail.store(m_acquiredTail + m_acquired, std::memory_order_release);
+  }
+
+  /// @brief calls func for every published record
+  template<typename FuncT>
+  void Consume(FuncT && func)
+  {
+    const uint64_t tail = m_tail.load(std::memory_order_acquire);
+    uint64_t head = m_head.load(std::memory_order_relaxed);
+    while (head != tail)
+    {
+      const size_t untilEnd = Capacity - head % Capacity;
+      if (untilEnd < sizeof(RecordHeader))
+      {
+        head += untilEnd; // too short tail which is skipped without header
+        continue;
+      }
+      RecordHeader header;
+      std::memcpy(&header, &m_buffer[head % Capacity], sizeof(RecordHeader));
+      if (header.format != nullptr)
+        func(header, &m_buffer[head % Capacity + sizeof(RecordHeader)]);
+      head += header.size;
+    }
+    m_head.store(head, std::memory_order_release);
+  }
+
+  bool Empty() const noexcept
+  {
+    return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+  }
+
+  /// @brief messages dropped because the ring was full
+  std::atomic<size_t> dropped = 0;
+
+private:
+  alignas(64) std::atomic<uint64_t> m_head = 0; ///< written by logger thread
+  alignas(64) std::atomic<uint64_t> m_tail = 0; ///< written by owner thread
+  uint64_t m_acquiredTail = 0;
+  size_t m_acquired = 0;
+  alignas(RecordHeader) std::byte m_buffer[Capacity];
+
+private:
+  void SkipTail(uint64_t tail) noexcept
+  {
+    const size_t untilEnd = Capacity - tail % Capacity;
+    if (untilEnd < sizeof(RecordHeader))
+      return;
+    RecordHeader skipped{};
+    skipped.size = static_cast<uint32_t>(untilEnd);
+    skipped.format = nullptr;
+    std::memcpy(&m_buffer[tail % Capacity], &skipped, sizeof(RecordHeader));
+  }
+};
+
+class AsyncLogger final
+{
+public:
+  AsyncLogger();
+  ~AsyncLogger();
+
+  bool IsEnabled(LogMessageType type) const noexcept
+  {
+    return GetSeverity(type) >= m_level.load(std::memory_order_relaxed);
+  }
+  void SetLevel(LogMessageType level) noexcept
+  {
+    m_level.store(GetSeverity(level), std::memory_order_relaxed);
+  }
+
+  RecordsRing & GetThreadRing();
+  void PushFormatted(LogRecord && record);
+  void AddSink(LogSinkUPtr && sink);
+  void ClearSinks();
+  void Flush();
+
+private:
+  std::atomic<int> m_level = 0;
+
+  std::mutex m_ringsLock; ///< guards m_rings, so new thread doesn't wait for sinks
+  std::vector<std::shared_ptr<RecordsRing>> m_rings;
+  std::vector<std::shared_ptr<RecordsRing>> m_drainedRings; ///< used by logger thread only
+
+  std::mutex m_sinksLock; ///< sinks are written under this lock only
+  std::vector<LogSinkUPtr> m_sinks;
+
+  std::mutex m_mutex; ///< guards everything below
+  std::condition_variable m_wakeUp;
+  std::condition_variable m_flushed;
+  std::vector<LogRecord> m_formatted; ///< messages formatted on calling threads
+  uint64_t m_flushRequest = 0;
+  uint64_t m_flushDone = 0;
+  bool m_stop = false;
+
+  std::thread m_thread;
+
+private:
+  void ThreadLoop();
+  /// @brief collects messages of all rings to the batch and writes it to sinks
+  void WriteBatch(std::vector<LogRecord> & batch);
+};
+
+AsyncLogger::AsyncLogger()
+{
+  m_sinks.push_back(CreateConsoleLogSink());
+  m_thread = std::thread(&AsyncLogger::ThreadLoop, this);
+}
+
+AsyncLogger::~AsyncLogger()
+{
+  {
+    std::lock_guard lk{m_mutex};
+    m_stop = true;
+  }
+  m_wakeUp.notify_one();
+  m_thread.join();
+}
+
+RecordsRing & AsyncLogger::GetThreadRing()
+{
+  // logger keeps the ring after thread is finished until it's drained
+  thread_local std::shared_ptr<RecordsRing> t_ring = [this]
+  {
+    auto ring = std::make_shared<RecordsRing>();
+    std::lock_guard lk{m_ringsLock};
+    m_rings.push_back(ring);
+    return ring;
+  }();
+  return *t_ring;
+}
+
+void AsyncLogger::PushFormatted(LogRecord && record)
+{
+  {
+    std::lock_guard lk{m_mutex};
+    m_formatted.push_back(std::move(record));
+  }
+  m_wakeUp.notify_one();
+}
+
+void AsyncLogger::AddSink(LogSinkUPtr && sink)
+{
+  std::lock_guard lk{m_sinksLock};
+  m_sinks.push_back(std::move(sink));
+}
+
+void AsyncLogger::ClearSinks()
+{
+  std::lock_guard lk{m_sinksLock};
+  m_sinks.clear();
+}
+
+void AsyncLogger::Flush()
+{
+  std::unique_lock lk{m_mutex};
+  const uint64_t request = ++m_flushRequest;
+  m_wakeUp.notify_one();
+  m_flushed.wait(lk, [this, request] { return m_flushDone >= request; });
+}
+
+void AsyncLogger::ThreadLoop()
+{
+  using namespace std::chrono_literals;
+  std::vector<LogRecord> batch;
+  std::unique_lock lk{m_mutex};
+  while (true)
+  {
+    // producers don't notify on every message, so rings are polled
+    m_wakeUp.wait_for(lk, 5ms);
+    const bool stop = m_stop;
+    const uint64_t flushRequest = m_flushRequest;
+    // sinks are slow, so producers and flushes aren't blocked while they're written
+    lk.unlock();
+    WriteBatch(batch);
+    lk.lock();
+    m_flushDone = flushRequest;
+    m_flushed.notify_all();
+    if (stop)
+      return;
+  }
+}
+
+void AsyncLogger::WriteBatch(std::vector<LogRecord> & batch)
+{
+  batch.clear();
+  {
+    std::lock_guard lk{m_mutex};
+    std::swap(batch, m_formatted);
+  }
+  {
+    // rings of finished threads are removed when they're drained
+    std::lock_guard lk{m_ringsLock};
+    std::erase_if(m_rings, [](auto && ring) { return ring.use_count() == 1 && ring->Empty(); });
+    m_drainedRings = m_rings;
+  }
+
+  std::wostringstream stream;
+  for (auto && ring : m_drainedRings)
+  {
+    ring->Consume(
+      [&batch, &stream](const RecordHeader & header, const std::byte * args)
+      {
+        stream.str(L"");
+        stream.clear();
+        header.format(args, stream);
+        batch.push_back(LogRecord{header.type, header.time, stream.str()});
+      });
+    if (const size_t dropped = ring->dropped.exchange(0, std::memory_order_relaxed))
+    {
+      batch.push_back(LogRecord{LogMessageType::Warning, Clock::now(),
+                                std::to_wstring(dropped) + L" log messages were dropped"});
+    }
+  }
+  m_drainedRings.clear();
+
+  if (batch.empty())
+    return;
+  std::stable_sort(batch.begin(), batch.end(),
+                   [](const LogRecord & a, const LogRecord & b) { return a.time < b.time; });
+  std::lock_guard lk{m_sinksLock};
+  for (auto && sink : m_sinks)
+    sink->Write(batch);
+}
+
+AsyncLogger & GetLogger()
+{
+  static AsyncLogger s_logger;
+  return s_logger;
+}
+
+} // namespace
+
+GAME_FRAMEWORK_API LogSinkUPtr CreateConsoleLogSink()
+{
+  return std::make_unique<ConsoleLogSink>();
+}
+
+GAME_FRAMEWORK_API LogSinkUPtr CreateFileLogSink(const std::filesystem::path & path)
+{
+  return std::make_unique<FileLogSink>(path);
+}
+
+GAME_FRAMEWORK_API void AddLogSink(LogSinkUPtr && sink)
+{
+  GetLogger().AddSink(std::move(sink));
+}
+
+GAME_FRAMEWORK_API void ClearLogSinks()
+{
+  GetLogger().ClearSinks();
+}
+
+GAME_FRAMEWORK_API void SetLogLevel(LogMessageType level) noexcept
+{
+  GetLogger().SetLevel(level);
+}
+
+GAME_FRAMEWORK_API void FlushLog()
+{
+  GetLogger().Flush();
+}
+
+namespace details
+{
+
+GAME_FRAMEWORK_API bool IsLogEnabled(LogMessageType type) noexcept
+{
+  return GetLogger().IsEnabled(type);
+}
+
+GAME_FRAMEWORK_API std::byte * AcquireLogRecord(LogMessageType type, LogFormatFunc format,
+                                                size_t argsSize) noexcept
+{
+  auto && logger = GetLogger();
+  auto && ring = logger.GetThreadRing();
+  const size_t size = AlignRecordSize(sizeof(RecordHeader) + argsSize);
+  std::byte * record = ring.Acquire(size);
+  if (!record)
+  {
+    ring.dropped.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  const RecordHeader header{static_cast<uint32_t>(size), type, format, Clock::now()};
+  std::memcpy(record, &header, sizeof(RecordHeader));
+  return record + sizeof(RecordHeader);
+}
+
+GAME_FRAMEWORK_API void CommitLogRecord() noexcept
+{
+  GetLogger().GetThreadRing().Commit();
+}
+
+GAME_FRAMEWORK_API void LogImpl(LogMessageType type, std::wstring && message)
+{
+  GetLogger().PushFormatted(LogRecord{type, Clock::now(), std::move(message)});
+}
+
+} // namespace details
+
+} // namespace GameFramework
@@ -0,0 +1,234 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+/// minimal severity of messages which are compiled in: 0 - debug, 1 - info, 2 - warning, 3 - error
+#ifndef GAME_FRAMEWORK_LOG_LEVEL
+#define GAME_FRAMEWORK_LOG_LEVEL 0
+#endif
+
+namespace GameFramework
+{
+
+enum class LogMessageType : uint8_t
+{
+  Info,
+  Warning,
+  Error,
+  Debug
+};
+
+constexpr int GetSeverity(LogMessageType type) noexcept
+{
+  switch (type)
+  {
+    case LogMessageType::Debug:
+      return 0;
+    case LogMessageType::Info:
+      return 1;
+    case LogMessageType::Warning:
+      return 2;
+    case LogMessageType::Error:
+      return 3;
+  }
+  return 3;
+}
+
+/// @brief formatted message which is passed to sinks
+struct LogRecord final
+{
+  LogMessageType type;
+  std::chrono::steady_clock::time_point time;
+  std::wstring message;
+};
+
+/// @brief destination of log messages. Called from the logger thread only
+struct LogSink
+{
+  virtual ~LogSink() = default;
+  /// @brief write batch of messages. Records are ordered by time
+  virtual void Write(std::span<const LogRecord> records) = 0;
+};
+using LogSinkUPtr = std::unique_ptr<LogSink>;
+
+/// @brief writes messages to std::wcout, flushes once per batch
+GAME_FRAMEWORK_API LogSinkUPtr CreateConsoleLogSink();
+/// @brief appends messages to the file, flushes once per batch
+GAME_FRAMEWORK_API LogSinkUPtr CreateFileLogSink(const std::filesystem::path & path);
+
+/// @brief add sink to the logger. Console sink is added by default
+GAME_FRAMEWORK_API void AddLogSink(LogSinkUPtr && sink);
+/// @brief remove all sinks including the default console one, e.g. to replace it
+GAME_FRAMEWORK_API void ClearLogSinks();
+/// @brief messages less severe than level are ignored
+GAME_FRAMEWORK_API void SetLogLevel(LogMessageType level) noexcept;
+/// @brief blocks until all messages logged before the call are written by sinks
+GAME_FRAMEWORK_API void FlushLog();
+
+namespace details
+{
+/// reads encoded arguments of the message and writes them to the stream
+using LogFormatFunc = void (*)(const std::byte * args, std::wostream & stream);
+
+GAME_FRAMEWORK_API bool IsLogEnabled(LogMessageType type) noexcept;
+/// @brief reserves space for encoded arguments in the ring of calling thread
+/// @return nullptr if the ring is full, then the message is dropped
+GAME_FRAMEWORK_API std::byte * AcquireLogRecord(LogMessageType type, LogFormatFunc format,
+                                                size_t argsSize) noexcept;
+/// @brief publishes last acquired record of calling thread to the logger thread
+GAME_FRAMEWORK_API void CommitLogRecord() noexcept;
+/// @brief slow path for messages which are too big for the ring, formatted on calling thread
+GAME_FRAMEWORK_API void LogImpl(LogMessageType type, std::wstring && message);
+/// @brief max size of arguments which are passed through the ring
+inline constexpr size_t MaxDeferredArgsSize = 4096;
+
+template<typename T>
+concept NarrowString = std::convertible_to<const T &, std::string_view>;
+
+template<typename T>
+concept WideString = std::convertible_to<const T &, std::wstring_view>;
+
+template<typename T>
+concept TrivialArg = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+/// tags of encoded strings
+struct EncodedNarrowString;
+struct EncodedWideString;
+
+/// arguments are prepared on calling thread: strings are viewed,
+/// trivial values are copied, other types are formatted with operator<<
+template<typename T>
+decltype(auto) PrepareLogArg(const T & value)
+{
+  if constexpr (TrivialArg<T>)
+    return value;
+  else if constexpr (NarrowString<T>)
+    return std::string_view(value);
+  else if constexpr (WideString<T>)
+    return std::wstring_view(value);
+  else
+  {
+    thread_local std::wostringstream stream;
+    stream.str(L"");
+    stream.clear();
+    stream << value;
+    return stream.str();
+  }
+}
+
+template<typename T>
+using EncodedLogArg =
+  std::conditional_t<TrivialArg<T>, T,
+                     std::conditional_t<NarrowString<T>, EncodedNarrowString, EncodedWideString>>;
+
+template<typename T>
+size_t EncodedSize(const T & value) noexcept
+{
+  if constexpr (TrivialArg<T>)
+    return sizeof(T);
+  else
+    return sizeof(uint32_t) + value.size() * sizeof(value[0]);
+}
+
+template<typename T>
+std::byte * Encode(std::byte * dst, const T & value) noexcept
+{
+  if constexpr (TrivialArg<T>)
+  {
+    std::memcpy(dst, &value, sizeof(T));
+    return dst + sizeof(T);
+  }
+  else
+  {
+    const auto length = static_cast<uint32_t>(value.size());
+    std::memcpy(dst, &length, sizeof(length));
+    if (length > 0)
+      std::memcpy(dst + sizeof(length), value.data(), length * sizeof(value[0]));
+    return dst + EncodedSize(value);
+  }
+}
+
+template<typename EncodedT>
+const std::byte * DecodeTo(const std::byte * src, std::wostream & stream)
+{
+  if constexpr (std::is_same_v<EncodedT, EncodedNarrowString> ||
+                std::is_same_v<EncodedT, EncodedWideString>)
+  {
+    using CharT = std::conditional_t<std::is_same_v<EncodedT, EncodedWideString>, wchar_t, char>;
+    uint32_t length;
+    std::memcpy(&length, src, sizeof(length));
+    src += sizeof(length);
+    for (uint32_t i = 0; i < length; ++i, src += sizeof(CharT))
+    {
+      CharT c;
+      std::memcpy(&c, src, sizeof(CharT));
+      stream.put(static_cast<wchar_t>(c));
+    }
+    return src;
+  }
+  else
+  {
+    EncodedT value;
+    std::memcpy(&value, src, sizeof(EncodedT));
+    if constexpr (std::is_enum_v<EncodedT>)
+      stream << static_cast<std::underlying_type_t<EncodedT>>(value);
+    else
+      stream << value;
+    return src + sizeof(EncodedT);
+  }
+}
+
+template<typename... EncodedArgs>
+void FormatLogArgs([[maybe_unused]] const std::byte * args, std::wostream & stream)
+{
+  ((args = DecodeTo<EncodedArgs>(args, stream)), ...);
+}
+
+} // namespace details
+
+/// @brief Log message during game is running.
+///        Arguments are copied to the ring of calling thread and formatted by the logger thread
+template<typename... Args>
+inline void Log(LogMessageType type, Args &&... args)
+{
+  if (GetSeverity(type) < GAME_FRAMEWORK_LOG_LEVEL || !details::IsLogEnabled(type))
+    return;
+
+  using namespace details;
+  const std::tuple<decltype(PrepareLogArg(args))...> prepared{PrepareLogArg(args)...};
+  const size_t argsSize =
+    std::apply([](auto &&... a) { return (size_t{0} + ... + EncodedSize(a)); }, prepared);
+  auto encode = [&prepared](std::byte * dst)
+  { std::apply([dst](auto &&... a) mutable { ((dst = Encode(dst, a)), ...); }, prepared); };
+
+  constexpr LogFormatFunc format = &FormatLogArgs<EncodedLogArg<std::decay_t<Args>>...>;
+  if (argsSize > MaxDeferredArgsSize)
+  {
+    // too big for the ring, so it's formatted right here
+    auto buffer = std::make_unique<std::byte[]>(argsSize);
+    encode(buffer.get());
+    std::wostringstream stream;
+    format(buffer.get(), stream);
+    LogImpl(type, stream.str());
+  }
+  else if (std::byte * dst = AcquireLogRecord(type, format, argsSize))
+  {
+    encode(dst);
+    CommitLogRecord();
+  }
+}
+
+} // namespace GameFramework
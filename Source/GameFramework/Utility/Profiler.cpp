@@ -0,0 +1,244 @@
+#include "Profiler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace GameFramework
+{
+namespace
+{
+const auto g_epoch = std::chrono::steady_clock::now();
+
+int64_t NowNs() noexcept
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                              g_epoch)
+    .count();
+}
+
+struct Zone final
+{
+  const char * name;
+  int64_t start;
+  int64_t duration;
+};
+
+/// buffer of one thread. Only owner thread writes zones, published count is read by exporter
+struct ThreadBuffer final
+{
+  static constexpr size_t Capacity = 1 << 16;
+
+  explicit ThreadBuffer(uint32_t id)
+    : id(id)
+    , zones(Capacity)
+  {
+  }
+
+  const uint32_t id;
+  std::string name; ///< guarded by profiler mutex
+  std::vector<Zone> zones;
+  uint64_t capture = 0; ///< capture which zones belong to
+  std::atomic<uint64_t> publishedCapture = 0;
+  std::atomic<size_t> count = 0;
+  std::atomic<size_t> dropped = 0;
+};
+
+/// buffer is created by the first zone of the thread, name is kept until then
+thread_local std::shared_ptr<ThreadBuffer> t_buffer;
+thread_local std::string t_threadName;
+
+/// writes string as JSON string literal
+void WriteJsonString(std::ostream & os, std::string_view str)
+{
+  constexpr char hexDigits[] = "0123456789abcdef";
+  os << '"';
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+      os << '\\' << c;
+    else if (static_cast<unsigned char>(c) < 0x20)
+      os << "\\u00" << hexDigits[(c >> 4) & 0xF] << hexDigits[c & 0xF];
+    else
+      os << c;
+  }
+  os << '"';
+}
+
+class ProfilerImpl final : public Profiler
+{
+public:
+  virtual void BeginCapture() override;
+  virtual void EndCapture() override { m_capturing.store(false, std::memory_order_relaxed); }
+  virtual bool IsCapturing() const noexcept override
+  {
+    return m_capturing.load(std::memory_order_relaxed);
+  }
+  virtual void SetThreadName(const char * name) override;
+  virtual size_t GetDroppedZonesCount() const noexcept override;
+  virtual bool ExportChromeTrace(const std::filesystem::path & path) const override;
+
+  void Submit(const char * name, int64_t start, int64_t end) noexcept;
+
+private:
+  std::atomic<bool> m_capturing = false;
+  std::atomic<uint64_t> m_capture = 0;
+  mutable std::mutex m_buffersLock;
+  std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+
+private:
+  ThreadBuffer & GetThreadBuffer();
+};
+
+ThreadBuffer & ProfilerImpl::GetThreadBuffer()
+{
+  // registry keeps buffer alive after thread is finished, so its zones are exported
+  if (!t_buffer)
+  {
+    std::lock_guard lk{m_buffersLock};
+    t_buffer = std::make_shared<ThreadBuffer>(static_cast<uint32_t>(m_buffers.size()));
+    t_buffer->name = t_threadName;
+    m_buffers.push_back(t_buffer);
+  }
+  return *t_buffer;
+}
+
+void ProfilerImpl::BeginCapture()
+{
+  m_capture.fetch_add(1, std::memory_order_relaxed);
+  m_capturing.store(true, std::memory_order_relaxed);
+}
+
+void ProfilerImpl::SetThreadName(const char * name)
+{
+  // buffer isn't created here, threads which never submit zones don't allocate it
+  t_threadName = name;
+  if (t_buffer)
+  {
+    std::lock_guard lk{m_buffersLock};
+    t_buffer->name = t_threadName;
+  }
+}
+
+size_t ProfilerImpl::GetDroppedZonesCount() const noexcept
+{
+  const uint64_t capture = m_capture.load(std::memory_order_relaxed);
+  std::lock_guard lk{m_buffersLock};
+  size_t result = 0;
+  for (auto && buffer : m_buffers)
+  {
+    if (buffer->publishedCapture.load(std::memory_order_acquire) == capture)
+      result += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+void ProfilerImpl::Submit(const char * name, int64_t start, int64_t end) noexcept
+{
+  auto && buffer = GetThreadBuffer();
+  const uint64_t capture = m_capture.load(std::memory_order_relaxed);
+  size_t count = buffer.count.load(std::memory_order_relaxed);
+  if (buffer.capture != capture)
+  {
+    // owner thread resets its buffer itself, so exporter never sees half-reset buffer
+    buffer.count.store(0, std::memory_order_relaxed);
+    buffer.dropped.store(0, std::memory_order_relaxed);
+    buffer.capture = capture;
+    buffer.publishedCapture.store(capture, std::memory_order_release);
+    count = 0;
+  }
+  if (count == ThreadBuffer::Capacity)
+  {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  buffer.zones[count] = Zone{name, start, end - start};
+  buffer.count.store(count + 1, std::memory_order_release);
+}
+
+bool ProfilerImpl::ExportChromeTrace(const std::filesystem::path & path) const
+{
+  std::ofstream file(path);
+  if (!file)
+    return false;
+
+  const uint64_t capture = m_capture.load(std::memory_order_relaxed);
+  std::lock_guard lk{m_buffersLock};
+  bool first = true;
+  auto separator = [&first]
+  {
+    const char * result = first ? "\n  " : ",\n  ";
+    first = false;
+    return result;
+  };
+
+  file << "{\"traceEvents\": [";
+  for (auto && buffer : m_buffers)
+  {
+    if (!buffer->name.empty())
+    {
+      file << separator() << R"({"name": "thread_name", "ph": "M", "pid": 0, "tid": )"
+           << buffer->id << R"(, "args": {"name": )";
+      WriteJsonString(file, buffer->name);
+      file << "}}";
+    }
+
+    if (buffer->publishedCapture.load(std::memory_order_acquire) != capture)
+      continue;
+    const size_t count = buffer->count.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i)
+    {
+      auto && zone = buffer->zones[i];
+      // trace_event timestamps are in microseconds
+      file << separator() << R"({"name": )";
+      WriteJsonString(file, zone.name);
+      file << R"(, "ph": "X", "pid": 0, "tid": )" << buffer->id << ", \"ts\": "
+           << zone.start / 1000 << '.' << zone.start % 1000 / 100 << ", \"dur\": "
+           << zone.duration / 1000 << '.' << zone.duration % 1000 / 100 << "}";
+    }
+  }
+  file << "\n]}\n";
+  return static_cast<bool>(file);
+}
+
+ProfilerImpl g_profiler;
+
+std::mutex g_zoneNamesLock;
+std::set<std::string, std::less<>> g_zoneNames; ///< nodes are stable, so names are kept by pointer
+
+} // namespace
+
+GAME_FRAMEWORK_API Profiler & GetProfiler()
+{
+  return g_profiler;
+}
+
+GAME_FRAMEWORK_API const char * InternProfileZoneName(std::string_view name)
+{
+  std::lock_guard lk{g_zoneNamesLock};
+  auto it = g_zoneNames.find(name);
+  if (it == g_zoneNames.end())
+    it = g_zoneNames.emplace(name).first;
+  return it->c_str();
+}
+
+ProfileZone::ProfileZone(const char * name) noexcept
+  : m_name(name)
+  , m_start(g_profiler.IsCapturing() ? NowNs() : -1)
+{
+}
+
+ProfileZone::~ProfileZone()
+{
+  if (m_start >= 0)
+    g_profiler.Submit(m_name, m_start, NowNs());
+}
+
+} // namespace GameFramework
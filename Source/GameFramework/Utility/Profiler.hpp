@@ -0,0 +1,69 @@
+#pragma once
+#include <GameFramework_def.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace GameFramework
+{
+
+/// @brief collects scoped zones of all threads during the capture.
+///        Every thread writes zones into its own buffer without locks,
+///        so zones are cheap and they cost almost nothing if capture isn't running
+struct Profiler
+{
+  virtual ~Profiler() = default;
+  /// @brief drops zones of previous capture and starts collecting new ones
+  virtual void BeginCapture() = 0;
+  virtual void EndCapture() = 0;
+  virtual bool IsCapturing() const noexcept = 0;
+  /// @brief name of calling thread in exported trace
+  virtual void SetThreadName(const char * name) = 0;
+  /// @brief count of zones which weren't stored because thread buffer was full
+  virtual size_t GetDroppedZonesCount() const noexcept = 0;
+  /// @brief writes zones of the last capture in Chrome trace_event format
+  ///        (chrome://tracing, Perfetto)
+  virtual bool ExportChromeTrace(const std::filesystem::path & path) const = 0;
+};
+
+GAME_FRAMEWORK_API Profiler & GetProfiler();
+
+/// @brief copy of the zone name which lives as long as the profiler.
+///        Equal names share one copy
+GAME_FRAMEWORK_API const char * InternProfileZoneName(std::string_view name);
+
+/// @brief measures time from construction to destruction. Name is stored by pointer until the
+///        trace is exported, so it must be interned if it belongs to a library which can be
+///        unloaded (PROFILE_ZONE does it)
+class GAME_FRAMEWORK_API ProfileZone final
+{
+public:
+  explicit ProfileZone(const char * name) noexcept;
+  ~ProfileZone();
+  ProfileZone(const ProfileZone &) = delete;
+  ProfileZone & operator=(const ProfileZone &) = delete;
+
+private:
+  const char * m_name;
+  int64_t m_start; ///< in nanoseconds, negative if capture wasn't running
+};
+
+} // namespace GameFramework
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef GAME_FRAMEWORK_PROFILING
+/// name is interned once per call site, so zones of hot-reloaded game don't point to its library
+#define PROFILE_ZONE_IMPL(name, id)                                                             \
+  static const char * const PROFILE_CONCAT(profileZoneName_, id) =                              \
+    ::GameFramework::InternProfileZoneName(name);                                               \
+  ::GameFramework::ProfileZone PROFILE_CONCAT(profileZone_, id)(                                \
+    PROFILE_CONCAT(profileZoneName_, id))
+#define PROFILE_ZONE(name) PROFILE_ZONE_IMPL(name, __COUNTER__)
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
+#else
+#define PROFILE_ZONE(name)
+#define PROFILE_FUNCTION()
+#endif
@@ -2,9 +2,11 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cassert>
 #include <cstdio>
 #include <ranges>
+#include <utility>
 
 #include <GLFW/glfw3.h>
 #include <GlfwInput.hpp>
@@ -15,8 +17,6 @@ namespace GlfwWindowsPlugin
 {
 
 GlfwInstance::GlfwInstance()
-  : m_joystickStates(JoystickCountLimit)
-  , m_oldJoystickStates(JoystickCountLimit)
 {
   glfwInit();
   glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
@@ -38,52 +38,107 @@ GlfwInstance::~GlfwInstance()
 
 void GlfwInstance::PollEvents()
 {
+  BeginPoll();
   glfwPollEvents();
-  std::swap(m_oldJoystickStates, m_joystickStates);
-  for (auto && [jid, description] : m_connectedJoysticks)
+  PollJoysticks();
+}
+
+void GlfwInstance::WaitEvents(double timeout)
+{
+  BeginPoll();
+  glfwWaitEventsTimeout(timeout);
+  PollJoysticks();
+}
+
+void GlfwInstance::BeginPoll() noexcept
+{
+  for (auto * wndPtr : m_trackedWindows)
+    wndPtr->ResetMouseAccumulators();
+
+  // states reported by joystick differ from the previous poll if its buttons were changed
+  // on this or the last poll (JUST_PRESSED becomes PRESSING) or its axes were moved
+  m_buttonsChangedBefore = std::exchange(m_buttonsChanged, 0);
+  m_changedJoysticks = 0;
+  m_joysticks.oldButtons = m_joysticks.buttons;
+}
+
+void GlfwInstance::PollJoysticks()
+{
+  for (JoysticksMask pending = m_connectedMask; pending != 0; pending &= pending - 1)
   {
-    if (description.isGamepad)
+    const int jid = std::countr_zero(pending);
+    if (!PollJoystick(jid, (m_gamepadsMask >> jid) & 1))
     {
-      GLFWgamepadstate state;
-      int res = glfwGetGamepadState(jid, &state);
-      if (res == GLFW_FALSE)
-      {
-        GameFramework::Log(GameFramework::LogMessageType::Warning, "Joystick - ", jid,
-                           " has been disconnected unexpectedly");
-        OnJoystickConnected(jid, false /*connected*/);
-        continue;
-      }
-      m_joystickStates[jid].axes.assign(state.axes, state.axes + 6);
-      m_joystickStates[jid].buttons.assign(state.buttons, state.buttons + 15);
+      GameFramework::Log(GameFramework::LogMessageType::Warning, "Joystick - ", jid,
+                         " has been disconnected unexpectedly");
+      OnJoystickConnected(jid, false /*connected*/);
     }
-    else // generic joystick
-    {
-      int axesCount = 0;
-      int buttonsCount = 0;
-      int hatsCount = 0;
-      const float * axes = glfwGetJoystickAxes(jid, &axesCount);
-      const uint8_t * buttons = glfwGetJoystickButtons(jid, &buttonsCount);
-      const uint8_t * hats = glfwGetJoystickHats(jid, &hatsCount);
-      if (!axes || !buttons || !hats)
-      {
-        GameFramework::Log(GameFramework::LogMessageType::Warning, "Joystick - ", jid,
-                           " has been disconnected unexpectedly");
-        OnJoystickConnected(jid, false /*connected*/);
-        continue;
-      }
+  }
+  m_changedJoysticks |= (m_buttonsChanged | m_buttonsChangedBefore) & m_connectedMask;
+}
 
-      m_joystickStates[jid].axes.assign(axes, axes + axesCount);
-      m_joystickStates[jid].buttons.assign(buttons, buttons + buttonsCount);
-      for (int i = 0; i < hatsCount; ++i)
+bool GlfwInstance::PollJoystick(int jid, bool isGamepad)
+{
+  std::array<float, JoystickAxesLimit> axes{};
+  size_t axesCount = 0;
+  JoystickButtonsMask buttons = 0;
+  if (isGamepad)
+  {
+    GLFWgamepadstate state;
+    if (glfwGetGamepadState(jid, &state) == GLFW_FALSE)
+      return false;
+    axesCount = std::size(state.axes);
+    std::copy_n(state.axes, axesCount, axes.begin());
+    for (size_t i = 0; i < std::size(state.buttons); ++i)
+      buttons |= JoystickButtonsMask{state.buttons[i] == GLFW_PRESS} << i;
+  }
+  else // generic joystick
+  {
+    int glfwAxesCount = 0;
+    int buttonsCount = 0;
+    int hatsCount = 0;
+    const float * glfwAxes = glfwGetJoystickAxes(jid, &glfwAxesCount);
+    const uint8_t * glfwButtons = glfwGetJoystickButtons(jid, &buttonsCount);
+    const uint8_t * hats = glfwGetJoystickHats(jid, &hatsCount);
+    if (!glfwAxes || !glfwButtons || !hats)
+      return false;
+
+    axesCount = std::min<size_t>(glfwAxesCount, JoystickAxesLimit);
+    std::copy_n(glfwAxes, axesCount, axes.begin());
+    size_t bit = 0;
+    for (int i = 0; i < buttonsCount && bit < JoystickButtonsLimit; ++i, ++bit)
+      buttons |= JoystickButtonsMask{glfwButtons[i] == GLFW_PRESS} << bit;
+    // the order is important because it's assosiated with GLFW_GAMEPAD_BUTTON_DPAD_*
+    constexpr std::array<uint8_t, 4> hatDirections{GLFW_HAT_UP, GLFW_HAT_RIGHT, GLFW_HAT_DOWN,
+                                                   GLFW_HAT_LEFT};
+    for (int i = 0; i < hatsCount; ++i)
+    {
+      for (uint8_t direction : hatDirections)
       {
-        // the order is important because it's assosiated with GLFW_GAMEPAD_BUTTON_DPAD_*
-        m_joystickStates[jid].buttons.push_back(hats[i] & GLFW_HAT_UP);
-        m_joystickStates[jid].buttons.push_back(hats[i] & GLFW_HAT_RIGHT);
-        m_joystickStates[jid].buttons.push_back(hats[i] & GLFW_HAT_DOWN);
-        m_joystickStates[jid].buttons.push_back(hats[i] & GLFW_HAT_LEFT);
+        if (bit < JoystickButtonsLimit)
+          buttons |= JoystickButtonsMask{(hats[i] & direction) != 0} << bit;
+        ++bit;
       }
     }
   }
+
+  const JoysticksMask jidBit = JoysticksMask{1} << jid;
+  if (buttons != m_joysticks.buttons[jid])
+    m_buttonsChanged |= jidBit;
+  if (axes != m_joysticks.axes[jid])
+    m_changedJoysticks |= jidBit;
+  m_joysticks.buttons[jid] = buttons;
+  m_joysticks.axes[jid] = axes;
+  m_joysticks.axesCount[jid] = static_cast<uint8_t>(axesCount);
+  return true;
+}
+
+void GlfwInstance::ResetJoystickState(int jid)
+{
+  m_joysticks.buttons[jid] = 0;
+  m_joysticks.oldButtons[jid] = 0;
+  m_joysticks.axes[jid] = {};
+  m_joysticks.axesCount[jid] = 0;
 }
 
 double GlfwInstance::GetTimestamp() const
@@ -102,42 +157,64 @@ void GlfwInstance::UntrackWindow(GlfwWindow * wnd)
   m_trackedWindows.erase(range.begin(), range.end());
 }
 
+namespace
+{
+GameFramework::PressState GetPressState(JoystickButtonsMask buttons, JoystickButtonsMask oldButtons,
+                                        int code) noexcept
+{
+  if (code < 0 || code >= static_cast<int>(JoystickButtonsLimit))
+    return GameFramework::PressState::RELEASED;
+  const bool isPressed = (buttons >> code) & 1;
+  const bool wasPressed = (oldButtons >> code) & 1;
+  // if it was pressed before, then it's long pressing state,
+  // if it's first press then it's JUST_PRESSED
+  // if release, then RELEASED
+  if (!isPressed)
+    return GameFramework::PressState::RELEASED;
+  return wasPressed ? GameFramework::PressState::PRESSING
+                    : GameFramework::PressState::JUST_PRESSED;
+}
+} // namespace
+
 GameFramework::PressState GlfwInstance::CheckJoystickButtonState(
   int jid, GameFramework::InputButton button) const noexcept
 {
-  auto && state = m_joystickStates[jid];
-  auto && oldState = m_oldJoystickStates[jid];
+  if (jid < 0 || jid >= static_cast<int>(JoystickCountLimit))
+    return GameFramework::PressState::RELEASED;
+  return GetPressState(m_joysticks.buttons[jid], m_joysticks.oldButtons[jid],
+                       ConvertJoystickButton2Code(button));
+}
 
-  int code = ConvertJoystickButton2Code(button);
-  // if it was pressed later, then it's long pressing state,
-  // if it's first press then it's JUST_PRESSED
-  // if release, then RELEASED
-  if (oldState.buttons[code] == GLFW_PRESS)
-  {
-    return state.buttons[code] == GLFW_PRESS ? GameFramework::PressState::PRESSING
-                                             : GameFramework::PressState::RELEASED;
-  }
-  else // GLFW_RELEASE
+void GlfwInstance::CheckJoystickButtonsState(
+  int jid, std::span<const GameFramework::InputButton> buttons,
+  std::span<GameFramework::PressState> states) const noexcept
+{
+  if (jid < 0 || jid >= static_cast<int>(JoystickCountLimit))
   {
-    return state.buttons[code] == GLFW_PRESS ? GameFramework::PressState::JUST_PRESSED
-                                             : GameFramework::PressState::RELEASED;
+    std::ranges::fill(states, GameFramework::PressState::RELEASED);
+    return;
   }
+  const JoystickButtonsMask current = m_joysticks.buttons[jid];
+  const JoystickButtonsMask old = m_joysticks.oldButtons[jid];
+  for (size_t i = 0; i < buttons.size(); ++i)
+    states[i] = GetPressState(current, old, ConvertJoystickButton2Code(buttons[i]));
 }
 
 GameFramework::AxisValue GlfwInstance::CheckJoystickAxisState(
   int jid, GameFramework::InputAxis axis) const noexcept
 {
-  using namespace GameFramework;
-  auto && state = m_joystickStates[jid];
-  int idx = ConvertJoystickAxis2Code(axis);
-  if (idx >= 0 && idx < state.axes.size())
-  {
-    return state.axes[idx];
-  }
-  else
-  {
-    return AxisNoValue;
-  }
+  if (jid < 0 || jid >= static_cast<int>(JoystickCountLimit))
+    return GameFramework::AxisNoValue;
+  const int idx = ConvertJoystickAxis2Code(axis);
+  if (idx >= 0 && idx < m_joysticks.axesCount[jid])
+    return m_joysticks.axes[jid][idx];
+  return GameFramework::AxisNoValue;
+}
+
+bool GlfwInstance::IsJoystickChanged(int jid) const noexcept
+{
+  return jid >= 0 && jid < static_cast<int>(JoystickCountLimit) &&
+         (m_changedJoysticks >> jid) & 1;
 }
 
 GameFramework::InputDeviceDescription GlfwInstance::GetDeviceDescription(
@@ -180,12 +257,19 @@ void GlfwInstance::OnJoystickConnected(int jid, bool connected)
     const uint8_t * buttons = glfwGetJoystickButtons(jid, &buttonsCount);
     const uint8_t * hats = glfwGetJoystickHats(jid, &hatsCount);
     description.buttonsCount = buttonsCount + hatsCount * 4; // one hat it's a 4 buttons
+    ResetJoystickState(jid);
+    m_connectedMask |= JoysticksMask{1} << jid;
+    if (description.isGamepad)
+      m_gamepadsMask |= JoysticksMask{1} << jid;
     GameFramework::Log(GameFramework::LogMessageType::Info, "Joystick ", description.name,
                        " connected");
   }
   else
   {
     m_connectedJoysticks.erase(jid);
+    m_connectedMask &= ~(JoysticksMask{1} << jid);
+    m_gamepadsMask &= ~(JoysticksMask{1} << jid);
+    ResetJoystickState(jid);
   }
 
   // TODO: remove
@@ -1,5 +1,7 @@
 #pragma once
 #include <array>
+#include <cstdint>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -11,6 +13,16 @@ namespace GlfwWindowsPlugin
 /// @brief Max count of gamepads
 static constexpr size_t JoystickCountLimit = GLFW_JOYSTICK_LAST + 1;
 static constexpr int UNKNOWN_JOYSITCK = -1;
+/// @brief Max count of axes and buttons stored for each joystick, a hat is stored as 4 buttons
+static constexpr size_t JoystickAxesLimit = 8;
+static constexpr size_t JoystickButtonsLimit = 32;
+
+/// bit per joystick
+using JoysticksMask = uint32_t;
+/// bit per button of joystick
+using JoystickButtonsMask = uint32_t;
+static_assert(JoystickCountLimit <= sizeof(JoysticksMask) * 8);
+static_assert(JoystickButtonsLimit <= sizeof(JoystickButtonsMask) * 8);
 
 struct GlfwWindow;
 
@@ -20,6 +32,8 @@ struct GlfwInstance final
   ~GlfwInstance();
   /// @brief poll glfw events and collect states from joysticks
   void PollEvents();
+  /// @brief wait for glfw events until timeout (in seconds) and collect states from joysticks
+  void WaitEvents(double timeout);
   double GetTimestamp() const;
 
   /// @brief store pointer on window. Used to say the window that new device is connected
@@ -33,6 +47,9 @@ struct GlfwInstance final
   GameFramework::PressState CheckJoystickButtonState(
     int jid, GameFramework::InputButton button) const noexcept;
 
+  void CheckJoystickButtonsState(int jid, std::span<const GameFramework::InputButton> buttons,
+                                 std::span<GameFramework::PressState> states) const noexcept;
+
   GameFramework::AxisValue CheckJoystickAxisState(int jid,
                                                   GameFramework::InputAxis axis) const noexcept;
 
@@ -41,20 +58,29 @@ struct GlfwInstance final
 
   std::vector<int> GetConnectedJoysticks() const;
 
+  /// @brief true if states of joystick's buttons or axes differ from the previous poll
+  bool IsJoystickChanged(int jid) const noexcept;
+
 private:
-  struct JoystickState
+  /// states of all joysticks in SoA layout, PollEvents overwrites it without allocations
+  struct JoysticksSnapshot final
   {
-    std::vector<float> axes;
-    std::vector<uint8_t> buttons;
+    alignas(64) std::array<JoystickButtonsMask, JoystickCountLimit> buttons{};
+    alignas(64) std::array<JoystickButtonsMask, JoystickCountLimit> oldButtons{};
+    alignas(64) std::array<std::array<float, JoystickAxesLimit>, JoystickCountLimit> axes{};
+    std::array<uint8_t, JoystickCountLimit> axesCount{};
   };
 
   std::vector<GlfwWindow *> m_trackedWindows;
 
   std::unordered_map<int, GameFramework::InputDeviceDescription> m_connectedJoysticks;
+  JoysticksMask m_connectedMask = 0;
+  JoysticksMask m_gamepadsMask = 0; ///< connected joysticks which have gamepad mapping
 
-  // joystick's states
-  std::vector<JoystickState> m_joystickStates;
-  std::vector<JoystickState> m_oldJoystickStates;
+  JoysticksSnapshot m_joysticks;
+  JoysticksMask m_changedJoysticks = 0;
+  JoysticksMask m_buttonsChanged = 0; ///< joysticks which buttons were changed on the last poll
+  JoysticksMask m_buttonsChangedBefore = 0;
 
 private: //Glfw callbacks
   static void OnGlfwError(int code, const char * description);
@@ -62,6 +88,13 @@ private: //Glfw callbacks
 
 private:
   void OnJoystickConnected(int jid, bool connected);
+  /// @brief resets states which are accumulated during one poll
+  void BeginPoll() noexcept;
+  void PollJoysticks();
+  /// @brief reads state of joystick to the snapshot
+  /// @return false if joystick is disconnected
+  bool PollJoystick(int jid, bool isGamepad);
+  void ResetJoystickState(int jid);
 };
 
 GlfwInstance & GetGlfwInstance();
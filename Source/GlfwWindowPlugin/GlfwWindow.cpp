@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <optional>
@@ -13,6 +14,7 @@
 #include <GLFW/glfw3native.h>
 /// clang-format on
 
+#include <Game/Time.hpp>
 #include <GlfwInput.hpp>
 #include <GlfwInstance.hpp>
 #include <GlfwWindow.hpp>
@@ -41,6 +43,7 @@ GlfwWindow::GlfwWindow(int id, const std::string & title, int width, int height)
   glfwSetScrollCallback(window, GlfwWindow::OnScroll);
   glfwSetKeyCallback(window, GlfwWindow::OnKeyAction);
   m_window = window;
+  StoreSize(width, height);
 }
 
 GlfwWindow::~GlfwWindow()
@@ -60,9 +63,16 @@ SurfaceDescriptor GlfwWindow::GetSurface() const noexcept
 
 std::pair<int, int> GlfwWindow::GetSize() const noexcept
 {
-  int width, height;
-  glfwGetWindowSize(m_window, &width, &height);
-  return {width, height};
+  // glfwGetWindowSize can be called on the main thread only, so size is cached on resize
+  const uint64_t size = m_size.load(std::memory_order_relaxed);
+  return {static_cast<int>(size >> 32), static_cast<int>(size & 0xFFFFFFFF)};
+}
+
+void GlfwWindow::StoreSize(int width, int height) noexcept
+{
+  const uint64_t size = (static_cast<uint64_t>(static_cast<uint32_t>(width)) << 32) |
+                        static_cast<uint32_t>(height);
+  m_size.store(size, std::memory_order_relaxed);
 }
 
 float GlfwWindow::GetAspectRatio() const noexcept
@@ -74,6 +84,9 @@ float GlfwWindow::GetAspectRatio() const noexcept
 void GlfwWindow::SetCursorHidden(bool hidden)
 {
   glfwSetInputMode(m_window, GLFW_CURSOR, hidden ? GLFW_CURSOR_DISABLED : GLFW_CURSOR_NORMAL);
+  // hidden cursor is used to control camera, so motion isn't affected by acceleration of OS
+  if (glfwRawMouseMotionSupported())
+    glfwSetInputMode(m_window, GLFW_RAW_MOUSE_MOTION, hidden ? GLFW_TRUE : GLFW_FALSE);
 }
 
 bool GlfwWindow::IsCursorHidden() const noexcept
@@ -138,9 +151,33 @@ PressState GlfwWindow::CheckButtonState(InputDevice device, InputButton btn) con
   return PressState::RELEASED;
 }
 
+void GlfwWindow::CheckButtonsState(InputDevice device, std::span<const InputButton> buttons,
+                                   std::span<PressState> states) const noexcept
+{
+  if (device == InputDevice::KEYBOARD || device == InputDevice::MOUSE)
+  {
+    for (size_t i = 0; i < buttons.size(); ++i)
+      states[i] = m_pressedButtons[static_cast<size_t>(buttons[i])];
+  }
+  else if (!!(device & InputDevice::ANY_JOYSTICK))
+  {
+    const int jid = InputDevice2JoystickId(device);
+    GetGlfwInstance().CheckJoystickButtonsState(jid, buttons, states);
+  }
+  else
+  {
+    std::ranges::fill(states, PressState::RELEASED);
+  }
+}
+
 AxisValue GlfwWindow::CheckAxisState(InputDevice device, InputAxis axis) const noexcept
 {
-  if (device == InputDevice::MOUSE && m_curCursorPos)
+  if (device == InputDevice::MOUSE && IsRelativeAxis(axis))
+  {
+    return m_mouseAccumulators[static_cast<size_t>(axis) -
+                               static_cast<size_t>(InputAxis::MOUSE_DELTA_X)];
+  }
+  else if (device == InputDevice::MOUSE && m_curCursorPos)
   {
     return axis == InputAxis::MOUSE_CURSOR_X ? m_curCursorPos->x : m_curCursorPos->y;
   }
@@ -152,15 +189,52 @@ AxisValue GlfwWindow::CheckAxisState(InputDevice device, InputAxis axis) const n
   return AxisNoValue;
 }
 
+bool GlfwWindow::IsEventDriven(InputDevice device) const noexcept
+{
+  // joysticks are polled by GlfwInstance
+  return device == InputDevice::KEYBOARD || device == InputDevice::MOUSE;
+}
+
+bool GlfwWindow::HasDeviceChanged(InputDevice device) const noexcept
+{
+  if (!!(device & InputDevice::ANY_JOYSTICK))
+    return GetGlfwInstance().IsJoystickChanged(InputDevice2JoystickId(device));
+  return true;
+}
+
 InputDeviceDescription GlfwWindow::GetInputDeviceDescription(InputDevice device) const noexcept
 {
   return GetGlfwInstance().GetDeviceDescription(device);
 }
 
+void GlfwWindow::ResetMouseAccumulators() noexcept
+{
+  m_mouseAccumulators.fill(0.0f);
+}
+
+void GlfwWindow::AccumulateMouseAxis(InputAxis axis, double value) noexcept
+{
+  m_mouseAccumulators[static_cast<size_t>(axis) - static_cast<size_t>(InputAxis::MOUSE_DELTA_X)] +=
+    static_cast<float>(value);
+}
+
+void GlfwWindow::SetButtonState(InputButton btn, PressState state)
+{
+  if (btn <= InputButton::UNKNOWN || btn >= InputButton::TOTAL)
+    return;
+  m_pressedButtons[static_cast<size_t>(btn)] = state;
+  if (m_controller)
+    m_controller->OnButtonStateChanged(
+      {GetTimeManager().Timestamp(), GetDeviceByButton(btn), btn, state});
+}
+
 void GlfwWindow::OnResizeCallback(GLFWwindow * window, int width, int height)
 {
   auto * wnd = reinterpret_cast<GlfwWindow *>(glfwGetWindowUserPointer(window));
-  if (wnd && wnd->onResize)
+  if (!wnd)
+    return;
+  wnd->StoreSize(width, height);
+  if (wnd->onResize)
     wnd->onResize(width, height);
 }
 
@@ -169,6 +243,12 @@ void GlfwWindow::OnCursorMoved(GLFWwindow * window, double xpos, double ypos)
   auto * wnd = reinterpret_cast<GlfwWindow *>(glfwGetWindowUserPointer(window));
   if (wnd)
   {
+    // several moves can be reported during one poll, all of them are accumulated
+    if (wnd->m_curCursorPos)
+    {
+      wnd->AccumulateMouseAxis(InputAxis::MOUSE_DELTA_X, xpos - wnd->m_curCursorPos->x);
+      wnd->AccumulateMouseAxis(InputAxis::MOUSE_DELTA_Y, ypos - wnd->m_curCursorPos->y);
+    }
     wnd->m_curCursorPos = {static_cast<float>(xpos), static_cast<float>(ypos), 0.0f};
   }
 }
@@ -195,20 +275,14 @@ void GlfwWindow::OnKeyAction(GLFWwindow * window, int key, int scancode, int act
 {
   auto * wnd = reinterpret_cast<GlfwWindow *>(glfwGetWindowUserPointer(window));
   if (wnd)
-  {
-    size_t btnIdx = static_cast<size_t>(ConvertMouseButtonCode(key));
-    wnd->m_pressedButtons[btnIdx] = ConvertPressState(action, mods);
-  }
+    wnd->SetButtonState(ConvertKeyboardButtonCode(key), ConvertPressState(action, mods));
 }
 
 void GlfwWindow::OnMouseButtonAction(GLFWwindow * window, int key, int action, int mods)
 {
   auto * wnd = reinterpret_cast<GlfwWindow *>(glfwGetWindowUserPointer(window));
   if (wnd)
-  {
-    size_t btnIdx = static_cast<size_t>(ConvertMouseButtonCode(key));
-    wnd->m_pressedButtons[btnIdx] = ConvertPressState(action, mods);
-  }
+    wnd->SetButtonState(ConvertMouseButtonCode(key), ConvertPressState(action, mods));
 }
 
 void GlfwWindow::OnScroll(GLFWwindow * window, double xoffset, double yoffset)
@@ -216,7 +290,8 @@ void GlfwWindow::OnScroll(GLFWwindow * window, double xoffset, double yoffset)
   auto * wnd = reinterpret_cast<GlfwWindow *>(glfwGetWindowUserPointer(window));
   if (wnd)
   {
-    //wnd->PushInputEvent(AxisAction{});
+    wnd->AccumulateMouseAxis(InputAxis::MOUSE_SCROLL_X, xoffset);
+    wnd->AccumulateMouseAxis(InputAxis::MOUSE_SCROLL_Y, yoffset);
   }
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <unordered_map>
 
 #include <GameFramework.hpp>
@@ -33,6 +35,11 @@ public: // InputBackend
     GameFramework::InputDevice device, GameFramework::InputButton btn) const noexcept override;
   virtual GameFramework::AxisValue CheckAxisState(
     GameFramework::InputDevice device, GameFramework::InputAxis axis) const noexcept override;
+  virtual void CheckButtonsState(
+    GameFramework::InputDevice device, std::span<const GameFramework::InputButton> buttons,
+    std::span<GameFramework::PressState> states) const noexcept override;
+  virtual bool IsEventDriven(GameFramework::InputDevice device) const noexcept override;
+  virtual bool HasDeviceChanged(GameFramework::InputDevice device) const noexcept override;
   virtual GameFramework::InputDeviceDescription GetInputDeviceDescription(
     GameFramework::InputDevice device) const noexcept override;
 
@@ -41,6 +48,8 @@ public: // Internal API
   /// @param jid - id of gamepad
   /// @param connected - true if connected, false otherwise
   void OnJoystickConnected(int jid, bool connected);
+  /// @brief called before polling of events, motion and scroll are accumulated until the next poll
+  void ResetMouseAccumulators() noexcept;
 
 private:
   int m_id;                                                ///< user-defined id of window
@@ -49,12 +58,21 @@ private:
   GameFramework::InputController * m_controller = nullptr; ///< doesn't own
 
   std::optional<GameFramework::Vec3f> m_curCursorPos; ///< position of cursor
+  /// @brief values of relative mouse axes (MOUSE_DELTA_X...MOUSE_SCROLL_Y) accumulated by callbacks
+  std::array<float, 4> m_mouseAccumulators{};
   /// @brief state of each button
   std::array<GameFramework::PressState, static_cast<size_t>(GameFramework::InputButton::TOTAL)>
     m_pressedButtons;
 
+  std::atomic<uint64_t> m_size = 0; ///< packed width and height, it's read from any thread
   ResizeCallback onResize = nullptr;
 
+private:
+  /// @brief store state of keyboard or mouse button and publish it to controller
+  void SetButtonState(GameFramework::InputButton btn, GameFramework::PressState state);
+  void StoreSize(int width, int height) noexcept;
+  void AccumulateMouseAxis(GameFramework::InputAxis axis, double value) noexcept;
+
 private:
   static void OnResizeCallback(GLFWwindow * window, int width, int height);
   static void OnCursorMoved(GLFWwindow * window, double xpos, double ypos);
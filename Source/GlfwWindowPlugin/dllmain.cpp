@@ -12,6 +12,7 @@ struct GlfwPlugin : public GameFramework::WindowsPlugin
   virtual GameFramework::WindowUPtr NewWindow(int id, const std::string & title, int width,
                                               int height) override;
   virtual void PollEvents() override;
+  virtual void WaitEvents(double timeout) override;
 };
 
 GameFramework::WindowUPtr GlfwPlugin::NewWindow(int id, const std::string & title, int width,
@@ -25,6 +26,11 @@ void GlfwPlugin::PollEvents()
   GetGlfwInstance().PollEvents();
 }
 
+void GlfwPlugin::WaitEvents(double timeout)
+{
+  GetGlfwInstance().WaitEvents(timeout);
+}
+
 } // namespace GlfwWindowsPlugin
 
 /// creates global game instance
@@ -1,8 +1,15 @@
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
+#include <cstdlib>
 #include <filesystem>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <utility>
 
 #include <Game/Time.hpp>
 #include <GameFramework.hpp>
@@ -26,6 +33,34 @@ void GameThread()
   }
 }
 
+/// screen device of window. Resize is reported on the thread which polls events of windows,
+/// but it's applied on the thread which renders
+struct Screen final
+{
+  GameFramework::ScreenDeviceUPtr device;
+
+  void RequestResize(int width, int height)
+  {
+    std::lock_guard lk{m_resizeMutex};
+    m_resize = {width, height};
+  }
+
+  void ApplyResize()
+  {
+    std::optional<std::pair<int, int>> resize;
+    {
+      std::lock_guard lk{m_resizeMutex};
+      resize.swap(m_resize);
+    }
+    if (resize && device)
+      device->OnResize(resize->first, resize->second);
+  }
+
+private:
+  std::mutex m_resizeMutex;
+  std::optional<std::pair<int, int>> m_resize;
+};
+
 int main(int argc, const char * argv[])
 {
   if (argc < 4)
@@ -36,15 +71,49 @@ int main(int argc, const char * argv[])
   std::unique_ptr<GameFramework::IPluginLoader> gamePlugin;
   std::unique_ptr<GameFramework::IPluginLoader> windowsPlugin;
   std::unique_ptr<GameFramework::IPluginLoader> renderPlugin;
+  GameFramework::InputRecorderUPtr inputRecorder;
+  GameFramework::InputReplayControllerUPtr inputReplay;
 
   std::filesystem::path gamePath = argv[1];
   std::filesystem::path windowsPluginPath = argv[2];
   std::filesystem::path renderPluginPath = argv[3];
+  // log categories setting like "Input=warning, Render=off"
+  if (const char * logConfig = std::getenv("GAME_FRAMEWORK_LOG"))
+    GameFramework::ConfigureLogCategories(logConfig);
+
+  // optional path of frame telemetry dump, .json or .csv
+  std::filesystem::path telemetryPath = argc > 4 ? argv[4] : "";
+  // optional path of profiler capture in Chrome trace format
+  std::filesystem::path tracePath = argc > 5 ? argv[5] : "";
+  // optional recording of input session or replay of recorded session instead of real input
+  const char * inputRecordPath = std::getenv("GAME_FRAMEWORK_INPUT_RECORD");
+  const char * inputReplayPath = std::getenv("GAME_FRAMEWORK_INPUT_REPLAY");
+  // 1 - recorded speed, 0 - frames are played as fast as possible
+  const char * inputReplaySpeed = std::getenv("GAME_FRAMEWORK_INPUT_REPLAY_SPEED");
+  const double replaySpeed = inputReplaySpeed ? std::atof(inputReplaySpeed) : 1.0;
+  // polls per second of input thread, input is polled once per frame if it isn't set
+  const char * inputRate = std::getenv("GAME_FRAMEWORK_INPUT_RATE");
+  const double inputPollingRate = inputRate ? std::atof(inputRate) : 0.0;
+  // game's library is reloaded when it's rebuilt, windows, devices and input are kept
+  const bool hotReload = std::getenv("GAME_FRAMEWORK_HOT_RELOAD") != nullptr;
+  if (!tracePath.empty())
+  {
+    GameFramework::GetProfiler().SetThreadName("Main");
+    GameFramework::GetProfiler().BeginCapture();
+  }
   try
   {
-    gamePlugin = GameFramework::LoadPlugin(gamePath);
-    windowsPlugin = GameFramework::LoadPlugin(windowsPluginPath);
-    renderPlugin = GameFramework::LoadPlugin(renderPluginPath);
+    // plugins are loaded in parallel, render plugin creates its context meanwhile
+    const GameFramework::PluginLoadInfo pluginsInfo[] = {
+      {gamePath, hotReload}, {windowsPluginPath}, {renderPluginPath}};
+    auto plugins = GameFramework::LoadPlugins(pluginsInfo);
+    gamePlugin = std::move(plugins[0]);
+    windowsPlugin = std::move(plugins[1]);
+    renderPlugin = std::move(plugins[2]);
+    if (inputRecordPath)
+      inputRecorder = GameFramework::CreateInputRecorder(inputRecordPath);
+    if (inputReplayPath)
+      inputReplay = GameFramework::CreateInputReplayController(inputReplayPath, replaySpeed);
   }
   catch (const std::exception & e)
   {
@@ -60,69 +129,216 @@ int main(int argc, const char * argv[])
   GameFramework::SignalsQueue signalsQueue;
 
   std::list<GameFramework::WindowUPtr> windows;
-  std::list<GameFramework::ScreenDeviceUPtr> drawDevices;
+  std::list<Screen> screens;
   std::list<GameFramework::InputControllerUPtr> inputControllers;
   for (auto && wndInfo : gameInstance->GetOutputConfiguration())
   {
     using namespace GameFramework;
     auto && wnd = windows.emplace_back(
       windowsManager->NewWindow(wndInfo.id, wndInfo.title, wndInfo.width, wndInfo.height));
-    auto && controller =
-      inputControllers.emplace_back(GameFramework::CreateInputController(wnd->GetInput()));
-    controller->BindInputQueue(input);
-    auto && device = drawDevices.emplace_back(renderManager->CreateScreenDevice(*wnd));
-    wnd->SetResizeCallback([dcPtr = device.get()](int w, int h) { dcPtr->OnResize(w, h); });
+    if (!inputReplay)
+    {
+      auto && controller =
+        inputControllers.emplace_back(GameFramework::CreateInputController(wnd->GetInput()));
+      controller->BindInputQueue(input);
+    }
+    auto && screen = screens.emplace_back();
+    screen.device = renderManager->CreateScreenDevice(*wnd, wndInfo.presentMode);
+    wnd->SetResizeCallback([&screen](int w, int h) { screen.RequestResize(w, h); });
+  }
+  GameFramework::InputReplayController * replay = inputReplay.get();
+  if (inputReplay)
+  {
+    inputReplay->BindInputQueue(input);
+    inputControllers.emplace_back(std::move(inputReplay));
+  }
+  if (inputRecorder)
+  {
+    for (auto && controller : inputControllers)
+      controller->BindInputQueue(inputRecorder->GetQueue());
   }
+  // replayed input is generated by frames, so it isn't polled by input thread
+  std::optional<GameFramework::InputPoller> inputPoller;
+  if (inputPollingRate > 0.0 && !replay)
+  {
+    inputPoller.emplace(*windowsManager, inputPollingRate);
+    for (auto && controller : inputControllers)
+      inputPoller->AddController(*controller);
+  }
+  const bool acceleratedReplay = replay && replaySpeed <= 0.0;
   gameInstance->ListenInputQueue(input);
   gameInstance->BindSignalsQueue(signalsQueue);
+  gameInstance->LoadScene(renderManager->GetRetainedScene3D());
 
   // in the beginning we must read and update input configuration
   signalsQueue.PushSignal(GameFramework::GameSignal::UpdateInputConfiguration);
 
-  while (std::all_of(windows.begin(), windows.end(),
-                     [](const GameFramework::WindowUPtr & wnd) { return !wnd->ShouldClose(); }))
+  GameFramework::FramePacer pacer(gameInstance->GetTargetFrameRate());
+  auto && telemetry = GameFramework::GetFrameTelemetry();
+  std::atomic<bool> shouldQuit = false;
+  double nextReloadCheck = 0.0;
+  auto reloadGame = [&]
   {
+    // library is checked twice per second, it's enough to catch up with rebuilds
+    const double now = GameFramework::GetTimeManager().Now();
+    if (now < nextReloadCheck)
+      return;
+    nextReloadCheck = now + 0.5;
+    if (!gamePlugin->IsModified())
+      return;
+    PROFILE_ZONE("Reload");
+    if (!GameFramework::ReloadGamePlugin(*gamePlugin))
+      return;
+    gameInstance = dynamic_cast<GameFramework::GamePlugin *>(gamePlugin->GetInstance());
+    pacer.SetTargetFrameRate(gameInstance->GetTargetFrameRate());
+    gameInstance->ListenInputQueue(input);
+    gameInstance->BindSignalsQueue(signalsQueue);
+    signalsQueue.PushSignal(GameFramework::GameSignal::UpdateInputConfiguration);
+    signalsQueue.PushSignal(GameFramework::GameSignal::InvalidateRenderCache);
+  };
+  auto runFrame = [&]
+  {
+    using GameFramework::FrameStage;
+    PROFILE_ZONE("Frame");
+    {
+      PROFILE_ZONE("Wait");
+      telemetry.Record(FrameStage::Wait, acceleratedReplay ? 0.0 : pacer.Wait());
+    }
     GameFramework::GetTimeManager().Tick();
-    windowsManager->PollEvents();
-    for (auto && controller : inputControllers)
-      controller->GenerateInputEvents();
-    gameInstance->ProcessInput();
+    if (hotReload)
+      reloadGame();
+    if (!inputPoller)
+    {
+      PROFILE_ZONE("Poll");
+      auto scope = telemetry.Measure(FrameStage::Poll);
+      windowsManager->PollEvents();
+    }
+    {
+      PROFILE_ZONE("Input");
+      auto scope = telemetry.Measure(FrameStage::Input);
+      // poller generates only events of buttons, states are taken once per frame
+      if (inputPoller)
+        inputPoller->GenerateFrameEvents();
+      else
+      {
+        for (auto && controller : inputControllers)
+          controller->GenerateInputEvents();
+      }
+      if (inputRecorder)
+      {
+        auto && time = GameFramework::GetTimeManager();
+        inputRecorder->RecordFrame(time.Now(), time.Delta());
+      }
+      gameInstance->ProcessInput();
+    }
 
-    renderManager->Tick();
+    {
+      PROFILE_ZONE("RenderPlugin::Tick");
+      auto scope = telemetry.Measure(FrameStage::Render);
+      renderManager->Tick();
+    }
 
-    for (auto && dc : drawDevices)
+    for (auto && screen : screens)
     {
-      if (dc && dc->BeginFrame())
+      auto && dc = screen.device;
+      bool frameStarted;
       {
-        gameInstance->Render(*dc);
+        PROFILE_ZONE("BeginFrame");
+        auto scope = telemetry.Measure(FrameStage::Present);
+        screen.ApplyResize();
+        frameStarted = dc && dc->BeginFrame();
+      }
+      if (frameStarted)
+      {
+        {
+          PROFILE_ZONE("Render");
+          auto scope = telemetry.Measure(FrameStage::Render);
+          gameInstance->Render(*dc);
+        }
+        PROFILE_ZONE("EndFrame");
+        auto scope = telemetry.Measure(FrameStage::Present);
         dc->EndFrame();
       }
     }
 
-    while (auto signal = signalsQueue.PopSignal())
     {
-      switch (signal.value())
+      PROFILE_ZONE("Tick");
+      auto tickScope = telemetry.Measure(FrameStage::Tick);
+      while (auto signal = signalsQueue.PopSignal())
       {
-        case GameFramework::GameSignal::UpdateInputConfiguration:
-        {
-          auto conf = gameInstance->GetInputConfiguration();
-          for (auto && controller : inputControllers)
-            controller->SetInputBindings(conf);
-        }
-        break;
-        case GameFramework::GameSignal::Quit:
-          return 0;
-        case GameFramework::GameSignal::InvalidateRenderCache:
+        switch (signal.value())
         {
-          for (auto && dc : drawDevices)
-            dc->Refresh();
+          case GameFramework::GameSignal::UpdateInputConfiguration:
+          {
+            auto conf = gameInstance->GetInputConfiguration();
+            if (inputPoller)
+              inputPoller->SetInputBindings(std::move(conf));
+            else
+            {
+              for (auto && controller : inputControllers)
+                controller->SetInputBindings(conf);
+            }
+          }
+          break;
+          case GameFramework::GameSignal::Quit:
+            shouldQuit = true;
+            break;
+          case GameFramework::GameSignal::InvalidateRenderCache:
+          {
+            for (auto && screen : screens)
+              screen.device->Refresh();
+          }
+          break;
         }
-        break;
       }
+
+      // replayed session is ticked with recorded deltas, so it's reproducible
+      gameInstance->Tick(replay ? replay->GetFrameDelta()
+                                : GameFramework::GetTimeManager().Delta());
     }
+    telemetry.EndFrame();
+  };
+  auto isGameFinished = [&] { return shouldQuit || (replay && replay->IsFinished()); };
+  auto isWindowClosed = [&windows]
+  {
+    return std::any_of(windows.begin(), windows.end(),
+                       [](const GameFramework::WindowUPtr & wnd) { return wnd->ShouldClose(); });
+  };
 
-    gameInstance->Tick(GameFramework::GetTimeManager().Delta());
+  if (inputPoller)
+  {
+    // events of windows must be polled on the main thread, so the game runs on another thread
+    std::thread gameThread(
+      [&]
+      {
+        if (!tracePath.empty())
+          GameFramework::GetProfiler().SetThreadName("Game");
+        while (!isGameFinished())
+          runFrame();
+        inputPoller->Stop();
+      });
+    inputPoller->Run(isWindowClosed);
+    shouldQuit = true;
+    gameThread.join();
+  }
+  else
+  {
+    while (!isGameFinished() && !isWindowClosed())
+      runFrame();
   }
 
+  if (!tracePath.empty())
+  {
+    GameFramework::GetProfiler().EndCapture();
+    if (!GameFramework::GetProfiler().ExportChromeTrace(tracePath))
+      std::printf("Failed to write profiler capture to %s", tracePath.string().c_str());
+  }
+  if (!telemetryPath.empty())
+  {
+    const bool dumped = telemetryPath.extension() == ".json" ? telemetry.DumpJSON(telemetryPath)
+                                                             : telemetry.DumpCSV(telemetryPath);
+    if (!dumped)
+      std::printf("Failed to write frame telemetry to %s", telemetryPath.string().c_str());
+  }
   return 0;
 }
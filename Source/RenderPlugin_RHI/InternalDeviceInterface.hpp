@@ -1,10 +1,18 @@
 #pragma once
+#include <functional>
+#include <vector>
 
 #include <OwnedBy.hpp>
 #include <RHI.hpp>
 
 namespace RenderPlugin
 {
+/// @brief recording of subpasses of the frame. Each task records only its own subpass,
+///        so tasks can be executed in parallel
+using RecordTasks = std::vector<std::function<void()>>;
+
+class SharedSceneData;
+
 struct InternalDevice : public RHI::OwnedBy<RHI::IContext>
 {
   explicit InternalDevice(RHI::IContext & ctx)
@@ -17,5 +25,7 @@ struct InternalDevice : public RHI::OwnedBy<RHI::IContext>
 public:
   virtual void ConfigurePipeline(RHI::ISubpassConfiguration & config) const = 0;
   virtual RHI::IFramebuffer & GetFramebuffer() & noexcept = 0;
+  /// @brief data shared by all devices of the plugin
+  virtual SharedSceneData & GetSharedData() & noexcept = 0;
 };
 } // namespace RenderPlugin
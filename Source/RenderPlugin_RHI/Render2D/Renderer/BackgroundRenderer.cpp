@@ -3,7 +3,7 @@
 #include <Constants.hpp>
 #include <GameFramework.hpp>
 #include <Render2D/Scene2D_GPU.hpp>
-#include <ShaderFile.hpp>
+#include <ShaderCache.hpp>
 
 namespace RenderPlugin
 {
@@ -20,20 +20,7 @@ BackgroundRenderer::BackgroundRenderer(Scene2D_GPU & scene)
   subpassConfig.SetMeshTopology(RHI::MeshTopology::TriangleFan);
   m_colorDescriptor = subpassConfig.DeclareUniform({0, 0}, RHI::ShaderType::Fragment);
   m_colorDescriptor->AssignBuffer(*m_colorBuffer);
-  {
-    auto && stream =
-      GameFramework::GetFileManager().OpenRead(g_shadersDirectory / "background_vert.spv");
-    ShaderFile file;
-    stream->ReadValue<ShaderFile>(file);
-    subpassConfig.AttachShader(RHI::ShaderType::Vertex, file.GetSpirV());
-  }
-  {
-    auto && stream =
-      GameFramework::GetFileManager().OpenRead(g_shadersDirectory / "background_frag.spv");
-    ShaderFile file;
-    stream->ReadValue<ShaderFile>(file);
-    subpassConfig.AttachShader(RHI::ShaderType::Fragment, file.GetSpirV());
-  }
+  AttachShaders();
 }
 
 BackgroundRenderer::~BackgroundRenderer()
@@ -49,6 +36,9 @@ void BackgroundRenderer::SetBackground(const GameFramework::Color3f & color)
 
 void BackgroundRenderer::Submit()
 {
+  if (m_shadersGeneration != GetShaderCache().GetGeneration())
+    AttachShaders();
+
   if (m_renderPass && m_renderPass->ShouldBeInvalidated())
   {
     auto extent = GetScene().GetDevice().GetFramebuffer().GetExtent();
@@ -60,4 +50,15 @@ void BackgroundRenderer::Submit()
   }
 }
 
+void BackgroundRenderer::AttachShaders()
+{
+  auto && cache = GetShaderCache();
+  m_shadersGeneration = cache.GetGeneration();
+  auto && subpassConfig = m_renderPass->GetConfiguration();
+  m_vertexShader = cache.Load("background_vert.spv");
+  m_fragmentShader = cache.Load("background_frag.spv");
+  subpassConfig.AttachShader(RHI::ShaderType::Vertex, m_vertexShader->GetSpirV());
+  subpassConfig.AttachShader(RHI::ShaderType::Fragment, m_fragmentShader->GetSpirV());
+}
+
 } // namespace RenderPlugin
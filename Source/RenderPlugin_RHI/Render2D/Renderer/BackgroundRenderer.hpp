@@ -2,6 +2,7 @@
 #include <GameFramework.hpp>
 #include <OwnedBy.hpp>
 #include <RHI.hpp>
+#include <ShaderCache.hpp>
 
 namespace RenderPlugin
 {
@@ -22,5 +23,11 @@ private:
   RHI::ISubpass * m_renderPass = nullptr;
   RHI::IBufferGPU * m_colorBuffer = nullptr;
   RHI::IBufferUniformDescriptor * m_colorDescriptor = nullptr;
+  ShaderModulePtr m_vertexShader;   ///< modules are kept alive while pipeline uses them
+  ShaderModulePtr m_fragmentShader;
+  uint64_t m_shadersGeneration = 0;
+
+private:
+  void AttachShaders();
 };
 } // namespace RenderPlugin
@@ -1,94 +1,38 @@
 #include "Rect2DRenderer.hpp"
 
-#include <Constants.hpp>
-#include <GameFramework.hpp>
+#include <cstddef>
+
 #include <Render2D/Scene2D_GPU.hpp>
-#include <ShaderFile.hpp>
 
 namespace RenderPlugin
 {
-Rect2DRenderer::Rect2DRenderer(Scene2D_GPU & scene)
-  : OwnedBy<Scene2D_GPU>(scene)
-  , m_renderPass(scene.GetDevice().GetFramebuffer().CreateSubpass())
+void Rect2DInstanceTraits::DeclareLayout(RHI::ISubpassConfiguration & config)
 {
-  m_verticesCpuBuffer.reserve(128);
-  auto && subpassConfig = m_renderPass->GetConfiguration();
-  scene.GetDevice().ConfigurePipeline(subpassConfig);
-  subpassConfig.EnableDepthTest(true);
-  subpassConfig.SetMeshTopology(RHI::MeshTopology::Triangle);
-  subpassConfig.AddInputBinding(0, 2 * sizeof(float), RHI::InputBindingType::VertexData);
-  subpassConfig.AddInputAttribute(0, 0, 0, 2, RHI::InputAttributeElementType::FLOAT);
-  {
-    auto && stream =
-      GameFramework::GetFileManager().OpenRead(g_shadersDirectory / "rect2d_vert.spv");
-    ShaderFile file;
-    stream->ReadValue<ShaderFile>(file);
-    subpassConfig.AttachShader(RHI::ShaderType::Vertex, file.GetSpirV());
-  }
-  {
-    auto && stream =
-      GameFramework::GetFileManager().OpenRead(g_shadersDirectory / "rect2d_frag.spv");
-    ShaderFile file;
-    stream->ReadValue<ShaderFile>(file);
-    subpassConfig.AttachShader(RHI::ShaderType::Fragment, file.GetSpirV());
-  }
+  config.AddInputBinding(0, sizeof(Rect2DInstance), RHI::InputBindingType::InstanceData);
+  config.AddInputAttribute(0, 0, offsetof(Rect2DInstance, left), 4,
+                           RHI::InputAttributeElementType::FLOAT);
+  config.AddInputAttribute(0, 1, offsetof(Rect2DInstance, color), 4,
+                           RHI::InputAttributeElementType::FLOAT);
+  config.AddInputAttribute(0, 2, offsetof(Rect2DInstance, z), 1,
+                           RHI::InputAttributeElementType::FLOAT);
 }
 
-Rect2DRenderer::~Rect2DRenderer()
+Rect2DRenderer::Rect2DRenderer(Scene2D_GPU & scene)
+  : OwnedBy<Scene2D_GPU>(scene)
+  , m_renderer(scene.GetDevice(), SharedScene::Immediate2D)
 {
-  //TODO: remove subpass
-  //TODO: remove buffer
 }
 
+Rect2DRenderer::~Rect2DRenderer() = default;
 
-void Rect2DRenderer::TrySetRects(size_t newHash, std::span<const GameFramework::Rect2d> rects)
+void Rect2DRenderer::SetRects(std::span<const Rect2DInstance> rects)
 {
-  if (newHash != m_hash)
-  {
-    size_t oldCapacity = m_verticesCpuBuffer.capacity();
-    m_verticesCpuBuffer.clear();
-    for (auto && rect : rects)
-    {
-      const float l = rect.X();
-      const float t = rect.Y();
-      const float r = rect.X() + rect.Width();
-      const float b = rect.Y() + rect.Height();
-      m_verticesCpuBuffer.emplace_back(l, t);
-      m_verticesCpuBuffer.emplace_back(r, t);
-      m_verticesCpuBuffer.emplace_back(l, b);
-      m_verticesCpuBuffer.emplace_back(l, b);
-      m_verticesCpuBuffer.emplace_back(r, t);
-      m_verticesCpuBuffer.emplace_back(r, b);
-    }
-
-    size_t newCapacity = m_verticesCpuBuffer.capacity();
-
-    if (newCapacity != oldCapacity || !m_verticesBuffer)
-    {
-      RHI::IBufferGPU * newVerticesBuffer =
-        GetScene().GetDevice().GetContext().AllocBuffer(newCapacity * 6 * 2 * sizeof(float),
-                                                        RHI::BufferGPUUsage::VertexBuffer, false);
-      //TODO: Delete old verticesBuffer
-      m_verticesBuffer = newVerticesBuffer;
-    }
-    m_verticesBuffer->UploadAsync(m_verticesCpuBuffer.data(),
-                                  m_verticesCpuBuffer.size() * 6 * 2 * sizeof(float));
-    m_hash = newHash;
-  }
+  m_renderer.SetInstances(rects);
 }
 
 void Rect2DRenderer::Submit()
 {
-  if (m_renderPass && m_renderPass->ShouldBeInvalidated() && !m_verticesCpuBuffer.empty())
-  {
-    auto extent = GetScene().GetDevice().GetFramebuffer().GetExtent();
-    m_renderPass->BeginPass();
-    m_renderPass->SetScissor(0, 0, extent[0], extent[1]);
-    m_renderPass->SetViewport(static_cast<float>(extent[0]), static_cast<float>(extent[1]));
-    m_renderPass->BindVertexBuffer(0, *m_verticesBuffer);
-    m_renderPass->DrawVertices(m_verticesCpuBuffer.size(), 1);
-    m_renderPass->EndPass();
-  }
+  m_renderer.Submit();
 }
 
 } // namespace RenderPlugin
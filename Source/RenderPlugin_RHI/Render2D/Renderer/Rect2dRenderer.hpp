@@ -1,12 +1,35 @@
 #pragma once
 #include <GameFramework.hpp>
 #include <OwnedBy.hpp>
+#include <Renderer/InstancedRenderer.hpp>
 #include <RHI.hpp>
 
 namespace RenderPlugin
 {
 struct Scene2D_GPU;
 
+/// @brief packed rect data (one instance per rect)
+struct Rect2DInstance final
+{
+  float left = 0.0f;
+  float top = 0.0f;
+  float width = 0.0f;
+  float height = 0.0f;
+  GameFramework::Color4f color{1.0f, 0.0f, 0.0f, 1.0f};
+  float z = 0.0f;
+};
+
+/// @brief rect is drawn by 6 vertices generated in shader from its instance
+struct Rect2DInstanceTraits final
+{
+  using Instance = Rect2DInstance;
+  static constexpr const char * VertexShader = "rect2d_vert.spv";
+  static constexpr const char * FragmentShader = "rect2d_frag.spv";
+  static constexpr RHI::MeshTopology Topology = RHI::MeshTopology::Triangle;
+  static constexpr uint32_t VerticesPerInstance = 6;
+  static void DeclareLayout(RHI::ISubpassConfiguration & config);
+};
+
 class Rect2DRenderer : public RHI::OwnedBy<Scene2D_GPU>
 {
 public:
@@ -15,13 +38,11 @@ public:
   MAKE_ALIAS_FOR_GET_OWNER(Scene2D_GPU, GetScene);
 
 public:
-  void TrySetRects(size_t newHash, std::span<const GameFramework::Rect2d> rects);
+  /// @brief set rects of the frame, only changed ones are uploaded
+  void SetRects(std::span<const Rect2DInstance> rects);
   void Submit();
 
 private:
-  size_t m_hash = 0;
-  std::vector<std::pair<float, float>> m_verticesCpuBuffer;
-  RHI::ISubpass * m_renderPass = nullptr;
-  RHI::IBufferGPU * m_verticesBuffer = nullptr;
+  InstancedRenderer<Rect2DInstanceTraits> m_renderer;
 };
 } // namespace RenderPlugin
@@ -1,7 +1,6 @@
 #include "Scene2D_CPU.hpp"
 
 #include <Render2D/Scene2D_GPU.hpp>
-#include <Utility/Utility.hpp>
 
 namespace RenderPlugin
 {
@@ -14,7 +13,7 @@ Scene2D_CPU::Scene2D_CPU(Scene2D_GPU & scene)
 Scene2D_CPU::~Scene2D_CPU()
 {
   assert(m_boundScene);
-  m_boundScene->TrySetRects(m_rectsHash, m_rectsToDraw);
+  m_boundScene->TrySetRects(m_rectsToDraw);
   m_boundScene->Draw();
 }
 
@@ -26,7 +25,7 @@ void Scene2D_CPU::SetBackground(const GameFramework::Color3f & color)
 
 void Scene2D_CPU::AddRect(const GameFramework::Rect2d & rect)
 {
-  m_rectsToDraw.push_back(rect);
-  GameFramework::Utils::hash_combine(m_rectsHash, rect);
+  m_rectsToDraw.push_back(
+    {rect.X(), rect.Y(), rect.Width(), rect.Height(), rect.GetColor(), rect.Z()});
 }
 } // namespace RenderPlugin
@@ -1,5 +1,6 @@
 #pragma once
 #include <GameFramework.hpp>
+#include <Render2D/Renderer/Rect2dRenderer.hpp>
 
 namespace RenderPlugin
 {
@@ -15,7 +16,6 @@ struct Scene2D_CPU final : public GameFramework::IRenderableScene2D
 
 private:
   Scene2D_GPU * m_boundScene = nullptr;
-  std::vector<GameFramework::Rect2d> m_rectsToDraw;
-  size_t m_rectsHash = 0;
+  std::vector<Rect2DInstance> m_rectsToDraw;
 };
 } // namespace RenderPlugin
@@ -3,6 +3,7 @@
 #include <Constants.hpp>
 #include <Files/FileManager.hpp>
 #include <ShaderFile.hpp>
+#include <Utility/Profiler.hpp>
 
 namespace RenderPlugin
 {
@@ -21,9 +22,10 @@ void Scene2D_GPU::SetBackground(const GameFramework::Color3f & color)
   m_backgroundRenderer.SetBackground(color);
 }
 
-void Scene2D_GPU::TrySetRects(size_t newHash, std::span<const GameFramework::Rect2d> rects)
+void Scene2D_GPU::TrySetRects(std::span<const Rect2DInstance> rects)
 {
-  m_rectsRenderer.TrySetRects(newHash, rects);
+  PROFILE_FUNCTION();
+  m_rectsRenderer.SetRects(rects);
 }
 
 void Scene2D_GPU::Invalidate()
@@ -33,8 +35,16 @@ void Scene2D_GPU::Invalidate()
 
 void Scene2D_GPU::Draw()
 {
-  m_backgroundRenderer.Submit();
-  m_rectsRenderer.Submit();
+  m_shouldBeDrawn = true;
+}
+
+void Scene2D_GPU::CollectRecordTasks(RecordTasks & tasks)
+{
+  if (!m_shouldBeDrawn)
+    return;
+  tasks.emplace_back([this] { m_backgroundRenderer.Submit(); });
+  tasks.emplace_back([this] { m_rectsRenderer.Submit(); });
+  m_shouldBeDrawn = false;
 }
 
 bool Scene2D_GPU::ShouldBeInvalidated() const noexcept
@@ -15,16 +15,20 @@ struct Scene2D_GPU final : public RHI::OwnedBy<InternalDevice>
   MAKE_ALIAS_FOR_GET_OWNER(InternalDevice, GetDevice);
 
   void SetBackground(const GameFramework::Color3f & color);
-  void TrySetRects(size_t newHash, std::span<const GameFramework::Rect2d> rects);
+  void TrySetRects(std::span<const Rect2DInstance> rects);
 
 public:
   void Invalidate();
+  /// @brief request recording of the scene in the end of frame
   void Draw();
+  /// @brief add recording of requested subpasses
+  void CollectRecordTasks(RecordTasks & tasks);
   bool ShouldBeInvalidated() const noexcept;
 
 private:
   BackgroundRenderer m_backgroundRenderer;
   Rect2DRenderer m_rectsRenderer;
+  bool m_shouldBeDrawn = false;
 };
 
 } // namespace RenderPlugin
@@ -1,7 +1,9 @@
 #version 450
 
+layout(location = 0) in vec4 inColor;
+
 layout(location = 0) out vec4 fragColor;
 
 void main() {
-    fragColor = vec4(vec3(1,0,0), 1.0);
-}
\ No newline at end of file
+    fragColor = inColor;
+}
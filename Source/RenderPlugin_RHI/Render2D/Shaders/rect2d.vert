@@ -1 +1 @@
-#version 450layout (location = 0) in vec2 inPos;void main() {    gl_Position = vec4(inPos, 0.0, 1.0);}
\ No newline at end of file
+#version 450layout (location = 0) in vec4 inRect; // left, top, width, heightlayout (location = 1) in vec4 inColor;layout (location = 2) in float inZ;layout (location = 0) out vec4 outColor;const vec2 rectCorners[6] = vec2[](    vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(0.0, 1.0),    vec2(0.0, 1.0), vec2(1.0, 0.0), vec2(1.0, 1.0));void main() {    vec2 corner = rectCorners[gl_VertexIndex];    gl_Position = vec4(inRect.xy + corner * inRect.zw, inZ, 1.0);    outColor = inColor;}
\ No newline at end of file
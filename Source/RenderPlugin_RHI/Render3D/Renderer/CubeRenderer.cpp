@@ -1,96 +1,45 @@
 #include "CubeRenderer.hpp"
 
-#include <algorithm>
-#include <ranges>
-
-#include <Constants.hpp>
-#include <GameFramework.hpp>
 #include <Render3D/Scene3D_GPU.hpp>
-#include <ShaderFile.hpp>
 
 namespace RenderPlugin
 {
 
-CubeRenderer::CubeRenderer(Scene3D_GPU & scene)
+void CubeInstanceTraits::DeclareLayout(RHI::ISubpassConfiguration & config)
+{
+  config.AddInputBinding(0, sizeof(GameFramework::Mat4f), RHI::InputBindingType::InstanceData);
+  config.AddInputAttribute(0, 0, 0, 4, RHI::InputAttributeElementType::FLOAT);
+  config.AddInputAttribute(0, 1, 1 * sizeof(GameFramework::Vec4f), 4,
+                           RHI::InputAttributeElementType::FLOAT);
+  config.AddInputAttribute(0, 2, 2 * sizeof(GameFramework::Vec4f), 4,
+                           RHI::InputAttributeElementType::FLOAT);
+  config.AddInputAttribute(0, 3, 3 * sizeof(GameFramework::Vec4f), 4,
+                           RHI::InputAttributeElementType::FLOAT);
+}
+
+CubeRenderer::CubeRenderer(Scene3D_GPU & scene, SharedScene sharedScene)
   : OwnedBy<Scene3D_GPU>(scene)
-  , m_renderPass(scene.GetDevice().GetFramebuffer().CreateSubpass())
+  , m_renderer(scene.GetDevice(), sharedScene)
 {
-  m_matricesCpuBuffer.reserve(128);
-  //   ScreenDevice
-  auto && subpassConfig = m_renderPass->GetConfiguration();
-  scene.GetDevice().ConfigurePipeline(subpassConfig);
-  subpassConfig.EnableDepthTest(true);
-  subpassConfig.SetMeshTopology(RHI::MeshTopology::Triangle);
-  subpassConfig.AddInputBinding(0, sizeof(GameFramework::Mat4f),
-                                RHI::InputBindingType::InstanceData);
-  subpassConfig.AddInputAttribute(0, 0, 0, 4, RHI::InputAttributeElementType::FLOAT);
-  subpassConfig.AddInputAttribute(0, 1, 1 * sizeof(GameFramework::Vec4f), 4,
-                                  RHI::InputAttributeElementType::FLOAT);
-  subpassConfig.AddInputAttribute(0, 2, 2 * sizeof(GameFramework::Vec4f), 4,
-                                  RHI::InputAttributeElementType::FLOAT);
-  subpassConfig.AddInputAttribute(0, 3, 3 * sizeof(GameFramework::Vec4f), 4,
-                                  RHI::InputAttributeElementType::FLOAT);
-  {
-    auto && stream = GameFramework::GetFileManager().OpenRead(g_shadersDirectory / "Cube_vert.spv");
-    ShaderFile file;
-    stream->ReadValue<ShaderFile>(file);
-    subpassConfig.AttachShader(RHI::ShaderType::Vertex, file.GetSpirV());
-  }
-  m_vpDescriptor = subpassConfig.DeclareUniform({0, 0}, RHI::ShaderType::Vertex);
+  m_vpDescriptor = m_renderer.GetConfiguration().DeclareUniform({0, 0}, RHI::ShaderType::Vertex);
   m_vpDescriptor->AssignBuffer(*scene.GetViewProjectionBuffer());
-
-  //   
-  {
-    auto && stream = GameFramework::GetFileManager().OpenRead(g_shadersDirectory / "Cube_frag.spv");
-    ShaderFile file;
-    stream->ReadValue<ShaderFile>(file);
-    subpassConfig.AttachShader(RHI::ShaderType::Fragment, file.GetSpirV());
-  }
 }
 
-CubeRenderer::~CubeRenderer()
+CubeRenderer::~CubeRenderer() = default;
+
+void CubeRenderer::SetCubes(std::span<const GameFramework::Mat4f> transforms)
 {
-  //TODO: remove subpass
-  //TODO: remove buffer
+  m_renderer.SetInstances(transforms);
 }
 
-void CubeRenderer::TrySetCubes(size_t newHash, std::span<const GameFramework::Cube> cubes)
+void CubeRenderer::SetCubes(std::span<const GameFramework::Mat4f> transforms, uint64_t version)
 {
-  if (newHash != m_hash)
-  {
-    size_t oldCapacity = m_matricesCpuBuffer.capacity();
-    m_matricesCpuBuffer.clear();
-    for (auto && cube : cubes)
-      m_matricesCpuBuffer.push_back(cube.GetTransform());
-
-    size_t newCapacity = m_matricesCpuBuffer.capacity();
-
-    if (newCapacity != oldCapacity || !m_matricesBuffer)
-    {
-      RHI::IBufferGPU * newVerticesBuffer =
-        GetScene().GetDevice().GetContext().AllocBuffer(newCapacity * sizeof(GameFramework::Mat4f),
-                                                        RHI::BufferGPUUsage::VertexBuffer, false);
-      //TODO: Delete old verticesBuffer
-      m_matricesBuffer = newVerticesBuffer;
-    }
-    m_matricesBuffer->UploadAsync(m_matricesCpuBuffer.data(),
-                                  m_matricesCpuBuffer.size() * sizeof(GameFramework::Mat4f));
-    m_hash = newHash;
-  }
+  m_renderer.SetInstances(transforms, version);
 }
 
 void CubeRenderer::Submit()
 {
-  if (m_renderPass && m_renderPass->ShouldBeInvalidated() && !m_matricesCpuBuffer.empty())
-  {
-    auto extent = GetScene().GetDevice().GetFramebuffer().GetExtent();
-    m_renderPass->BeginPass();
-    m_renderPass->SetScissor(0, 0, extent[0], extent[1]);
-    m_renderPass->SetViewport(static_cast<float>(extent[0]), static_cast<float>(extent[1]));
-    m_renderPass->BindVertexBuffer(0, *m_matricesBuffer);
-    m_renderPass->DrawVertices(36, m_matricesCpuBuffer.size());
-    m_renderPass->EndPass();
-  }
+  m_renderer.Submit();
 }
 
 } // namespace RenderPlugin
@@ -1,28 +1,40 @@
 #pragma once
 #include <GameFramework.hpp>
 #include <OwnedBy.hpp>
+#include <Renderer/InstancedRenderer.hpp>
 #include <RHI.hpp>
 
 namespace RenderPlugin
 {
 struct Scene3D_GPU;
 
+/// @brief cube is drawn by 36 vertices generated in shader, instance is its transform
+struct CubeInstanceTraits final
+{
+  using Instance = GameFramework::Mat4f;
+  static constexpr const char * VertexShader = "Cube_vert.spv";
+  static constexpr const char * FragmentShader = "Cube_frag.spv";
+  static constexpr RHI::MeshTopology Topology = RHI::MeshTopology::Triangle;
+  static constexpr uint32_t VerticesPerInstance = 36;
+  static void DeclareLayout(RHI::ISubpassConfiguration & config);
+};
+
 class CubeRenderer : public RHI::OwnedBy<Scene3D_GPU>
 {
 public:
-  explicit CubeRenderer(Scene3D_GPU & scene);
+  CubeRenderer(Scene3D_GPU & scene, SharedScene sharedScene);
   ~CubeRenderer();
   MAKE_ALIAS_FOR_GET_OWNER(Scene3D_GPU, GetScene);
 
 public:
-  void TrySetCubes(size_t newHash, std::span<const GameFramework::Cube> cubes);
+  /// @brief set transforms of cubes, only changed ones are uploaded
+  void SetCubes(std::span<const GameFramework::Mat4f> transforms);
+  /// @brief set transforms of retained cubes, they are uploaded only when version is changed
+  void SetCubes(std::span<const GameFramework::Mat4f> transforms, uint64_t version);
   void Submit();
 
 private:
-  size_t m_hash = 0;
-  std::vector<GameFramework::Mat4f> m_matricesCpuBuffer;
-  RHI::IBufferUniformDescriptor * m_vpDescriptor;
-  RHI::ISubpass * m_renderPass = nullptr;
-  RHI::IBufferGPU * m_matricesBuffer = nullptr;
+  InstancedRenderer<CubeInstanceTraits> m_renderer;
+  RHI::IBufferUniformDescriptor * m_vpDescriptor = nullptr;
 };
 } // namespace RenderPlugin
@@ -0,0 +1,75 @@
+#include "RetainedScene3D.hpp"
+
+#include <cassert>
+
+namespace RenderPlugin
+{
+
+GameFramework::RenderObjectHandle RetainedScene3D::AddCube(const GameFramework::Cube & cube)
+{
+  uint32_t slotIndex;
+  if (!m_freeSlots.empty())
+  {
+    slotIndex = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  }
+  else
+  {
+    slotIndex = static_cast<uint32_t>(m_slots.size());
+    m_slots.emplace_back();
+  }
+
+  Slot & slot = m_slots[slotIndex];
+  slot.denseIndex = static_cast<uint32_t>(m_cubeTransforms.size());
+  m_cubeTransforms.push_back(cube.GetTransform());
+  m_denseToSlot.push_back(slotIndex);
+  m_version++;
+  return {slotIndex, slot.generation};
+}
+
+void RetainedScene3D::UpdateCube(GameFramework::RenderObjectHandle handle,
+                                 const GameFramework::Cube & cube)
+{
+  if (const Slot * slot = FindSlot(handle))
+  {
+    m_cubeTransforms[slot->denseIndex] = cube.GetTransform();
+    m_version++;
+  }
+}
+
+void RetainedScene3D::RemoveObject(GameFramework::RenderObjectHandle handle)
+{
+  const Slot * slot = FindSlot(handle);
+  if (!slot)
+    return;
+
+  // move last object on place of removed one to keep arrays dense
+  const uint32_t removedIndex = slot->denseIndex;
+  const uint32_t lastIndex = static_cast<uint32_t>(m_cubeTransforms.size() - 1);
+  if (removedIndex != lastIndex)
+  {
+    m_cubeTransforms[removedIndex] = m_cubeTransforms[lastIndex];
+    m_denseToSlot[removedIndex] = m_denseToSlot[lastIndex];
+    m_slots[m_denseToSlot[removedIndex]].denseIndex = removedIndex;
+  }
+  m_cubeTransforms.pop_back();
+  m_denseToSlot.pop_back();
+
+  m_slots[handle.index].generation++;
+  m_freeSlots.push_back(handle.index);
+  m_version++;
+}
+
+const RetainedScene3D::Slot * RetainedScene3D::FindSlot(
+  GameFramework::RenderObjectHandle handle) const noexcept
+{
+  if (!handle.IsValid() || handle.index >= m_slots.size())
+    return nullptr;
+  const Slot & slot = m_slots[handle.index];
+  if (slot.generation != handle.generation)
+    return nullptr;
+  assert(slot.denseIndex < m_cubeTransforms.size());
+  return &slot;
+}
+
+} // namespace RenderPlugin
@@ -0,0 +1,50 @@
+#pragma once
+#include <span>
+#include <vector>
+
+#include <GameFramework.hpp>
+
+namespace RenderPlugin
+{
+
+/// @brief stores objects of retained scene in dense arrays which are ready to upload.
+///        Handles point to slots, slots point to dense index, so removing is O(1)
+struct RetainedScene3D final : public GameFramework::IRetainedScene3D
+{
+  RetainedScene3D() = default;
+  virtual ~RetainedScene3D() override = default;
+
+public: // IRetainedScene3D
+  virtual GameFramework::RenderObjectHandle AddCube(const GameFramework::Cube & cube) override;
+  virtual void UpdateCube(GameFramework::RenderObjectHandle handle,
+                          const GameFramework::Cube & cube) override;
+  virtual void RemoveObject(GameFramework::RenderObjectHandle handle) override;
+  virtual size_t GetObjectsCount() const noexcept override { return m_cubeTransforms.size(); }
+
+public:
+  /// @brief instance data of all cubes
+  std::span<const GameFramework::Mat4f> GetCubeTransforms() const & noexcept
+  {
+    return m_cubeTransforms;
+  }
+  /// @brief counter of changes, devices upload the scene when it differs from uploaded one
+  uint64_t GetVersion() const noexcept { return m_version; }
+
+private:
+  struct Slot
+  {
+    uint32_t denseIndex = 0;
+    uint32_t generation = 0;
+  };
+
+  std::vector<Slot> m_slots;
+  std::vector<uint32_t> m_freeSlots;
+  std::vector<uint32_t> m_denseToSlot;
+  std::vector<GameFramework::Mat4f> m_cubeTransforms;
+  uint64_t m_version = 0;
+
+private:
+  const Slot * FindSlot(GameFramework::RenderObjectHandle handle) const noexcept;
+};
+
+} // namespace RenderPlugin
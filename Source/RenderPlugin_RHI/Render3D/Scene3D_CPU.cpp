@@ -13,15 +13,14 @@ Scene3D_CPU::~Scene3D_CPU()
   if (m_boundScene)
   { 
     m_boundScene->SetCamera(m_camera);
-    m_boundScene->TrySetCubes(m_cubesHash, m_cubesToDraw);
+    m_boundScene->TrySetCubes(m_cubesToDraw);
     m_boundScene->Draw();
   }
 }
 
 void Scene3D_CPU::AddCube(const GameFramework::Cube & cube)
 {
-  m_cubesToDraw.push_back(cube);
-  GameFramework::Utils::hash_combine(m_cubesHash, cube);
+  m_cubesToDraw.push_back(cube.GetTransform());
 }
 
 void Scene3D_CPU::SetCamera(const GameFramework::Camera & camera)
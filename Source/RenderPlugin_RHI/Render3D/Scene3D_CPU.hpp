@@ -15,8 +15,7 @@ struct Scene3D_CPU final : public GameFramework::IRenderableScene3D
 
 private:
   Scene3D_GPU * m_boundScene = nullptr;
-  std::vector<GameFramework::Cube> m_cubesToDraw;
-  size_t m_cubesHash = 0;
+  std::vector<GameFramework::Mat4f> m_cubesToDraw; ///< transforms of cubes
   GameFramework::Camera m_camera;
 };
 } // namespace RenderPlugin
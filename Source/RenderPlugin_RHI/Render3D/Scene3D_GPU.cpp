@@ -1,12 +1,16 @@
 #include "Scene3D_GPU.hpp"
 
+#include <SharedSceneData.hpp>
+#include <Utility/Profiler.hpp>
+
 namespace RenderPlugin
 {
 Scene3D_GPU::Scene3D_GPU(InternalDevice & device)
   : OwnedBy<InternalDevice>(device)
   , m_viewProjBuffer(
       device.GetContext().AllocBuffer(sizeof(ViewProjection), RHI::UniformBuffer, true))
-  , m_cubesRenderer(*this)
+  , m_cubesRenderer(*this, SharedScene::Immediate3D)
+  , m_retainedCubesRenderer(*this, SharedScene::Retained3D)
 {
 }
 
@@ -15,9 +19,10 @@ Scene3D_GPU::~Scene3D_GPU()
   //TODO: delete m_viewProjBuffer
 }
 
-void Scene3D_GPU::TrySetCubes(size_t newHash, std::span<const GameFramework::Cube> cubes)
+void Scene3D_GPU::TrySetCubes(std::span<const GameFramework::Mat4f> transforms)
 {
-  m_cubesRenderer.TrySetCubes(newHash, cubes);
+  PROFILE_FUNCTION();
+  m_cubesRenderer.SetCubes(transforms);
 }
 
 void Scene3D_GPU::SetCamera(const GameFramework::Camera & camera)
@@ -38,7 +43,22 @@ void Scene3D_GPU::Invalidate()
 
 void Scene3D_GPU::Draw()
 {
-  m_cubesRenderer.Submit();
+  m_shouldBeDrawn = true;
+}
+
+void Scene3D_GPU::FlushRetained()
+{
+  // staging is shared, so only the first device which sees new version uploads it
+  auto && retainedScene = GetDevice().GetSharedData().GetRetainedScene();
+  m_retainedCubesRenderer.SetCubes(retainedScene.GetCubeTransforms(), retainedScene.GetVersion());
+}
+
+void Scene3D_GPU::CollectRecordTasks(RecordTasks & tasks)
+{
+  if (m_shouldBeDrawn)
+    tasks.emplace_back([this] { m_cubesRenderer.Submit(); });
+  tasks.emplace_back([this] { m_retainedCubesRenderer.Submit(); });
+  m_shouldBeDrawn = false;
 }
 
 bool Scene3D_GPU::ShouldBeInvalidated() const noexcept
@@ -20,7 +20,7 @@ struct Scene3D_GPU final : public RHI::OwnedBy<InternalDevice>
   virtual ~Scene3D_GPU() override;
   MAKE_ALIAS_FOR_GET_OWNER(InternalDevice, GetDevice);
 
-  void TrySetCubes(size_t newHash, std::span<const GameFramework::Cube> cubes);
+  void TrySetCubes(std::span<const GameFramework::Mat4f> transforms);
   void SetCamera(const GameFramework::Camera & camera);
 
 public:
@@ -28,12 +28,19 @@ public:
 
 public:
   void Invalidate();
+  /// @brief request recording of the scene in the end of frame
   void Draw();
+  /// @brief uploads changes of shared retained scene (if there are)
+  void FlushRetained();
+  /// @brief add recording of requested subpasses (retained scene is recorded every frame)
+  void CollectRecordTasks(RecordTasks & tasks);
   bool ShouldBeInvalidated() const noexcept;
 
 private:
   RHI::IBufferGPU * m_viewProjBuffer = nullptr;
   CubeRenderer m_cubesRenderer; // one for each material
+  CubeRenderer m_retainedCubesRenderer;
+  bool m_shouldBeDrawn = false;
 };
 
 } // namespace RenderPlugin
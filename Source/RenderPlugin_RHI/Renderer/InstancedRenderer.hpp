@@ -0,0 +1,159 @@
+#pragma once
+#include <concepts>
+#include <cstring>
+#include <memory>
+
+#include <Constants.hpp>
+#include <GameFramework.hpp>
+#include <InternalDeviceInterface.hpp>
+#include <OwnedBy.hpp>
+#include <Render/InstanceBatch.hpp>
+#include <Renderer/SharedUploads.hpp>
+#include <RHI.hpp>
+#include <ShaderCache.hpp>
+#include <SharedSceneData.hpp>
+
+namespace RenderPlugin
+{
+
+/// @brief description of instanced primitive for InstancedRenderer
+template<typename T>
+concept InstanceTraits = requires(RHI::ISubpassConfiguration & config) {
+  typename T::Instance;
+  { T::VertexShader } -> std::convertible_to<const char *>;   ///< name of compiled vertex shader
+  { T::FragmentShader } -> std::convertible_to<const char *>; ///< name of compiled fragment shader
+  { T::Topology } -> std::convertible_to<RHI::MeshTopology>;
+  { T::VerticesPerInstance } -> std::convertible_to<uint32_t>;
+  { T::DeclareLayout(config) }; ///< declares input binding 0 and its attributes
+};
+
+/*
+* Draws all instances of one primitive type with one draw call.
+* Instances are staged once per shared scene for all devices and only changed ones are uploaded.
+* Device whose instances differ from the staged ones (e.g. another window shows other objects)
+* keeps them in its own staging
+*/
+template<InstanceTraits TraitsT>
+class InstancedRenderer final : public RHI::OwnedBy<InternalDevice>
+{
+public:
+  using Instance = typename TraitsT::Instance;
+
+  InstancedRenderer(InternalDevice & device, SharedScene scene);
+  virtual ~InstancedRenderer() override = default;
+  MAKE_ALIAS_FOR_GET_OWNER(InternalDevice, GetDevice);
+
+public:
+  /// @brief configuration of the subpass to declare additional uniforms
+  RHI::ISubpassConfiguration & GetConfiguration() & { return m_renderPass->GetConfiguration(); }
+
+  /// @brief set instances of immediate scene. The first device of the frame stages them,
+  ///        other devices only compare theirs with the staged ones
+  void SetInstances(std::span<const Instance> instances);
+  /// @brief set instances of retained scene, they are staged only when version is changed
+  void SetInstances(std::span<const Instance> instances, uint64_t version);
+  void Submit();
+
+private:
+  using Staging = InstanceStaging<Instance>;
+
+  RHI::ISubpass * m_renderPass = nullptr;
+  std::shared_ptr<Staging> m_sharedStaging;
+  Staging m_ownStaging;                ///< instances of this device if they differ from shared
+  const Staging * m_drawnStaging = nullptr;
+  ShaderModulePtr m_vertexShader;   ///< modules are kept alive while pipeline uses them
+  ShaderModulePtr m_fragmentShader;
+  uint64_t m_shadersGeneration = 0;
+  static constexpr char s_layoutTag = 0; ///< address identifies instance layout in SharedUploads
+
+private:
+  void AttachShaders();
+};
+
+
+template<InstanceTraits TraitsT>
+inline InstancedRenderer<TraitsT>::InstancedRenderer(InternalDevice & device, SharedScene scene)
+  : OwnedBy<InternalDevice>(device)
+  , m_renderPass(device.GetFramebuffer().CreateSubpass())
+  , m_sharedStaging(device.GetSharedData().GetUploads().GetStaging<Instance>(&s_layoutTag, scene))
+  , m_drawnStaging(m_sharedStaging.get())
+{
+  auto && subpassConfig = m_renderPass->GetConfiguration();
+  device.ConfigurePipeline(subpassConfig);
+  subpassConfig.EnableDepthTest(true);
+  subpassConfig.SetMeshTopology(TraitsT::Topology);
+  TraitsT::DeclareLayout(subpassConfig);
+  AttachShaders();
+}
+
+template<InstanceTraits TraitsT>
+inline void InstancedRenderer<TraitsT>::SetInstances(std::span<const Instance> instances)
+{
+  PROFILE_ZONE("InstancedRenderer::SetInstances");
+  auto && ctx = GetDevice().GetContext();
+  const uint64_t frame = GetDevice().GetSharedData().GetFrame();
+  if (m_sharedStaging->version != frame)
+  {
+    m_sharedStaging->Update(ctx, instances);
+    m_sharedStaging->version = frame;
+    m_drawnStaging = m_sharedStaging.get();
+    return;
+  }
+
+  const auto staged = m_sharedStaging->batch.GetInstances();
+  if (staged.size() == instances.size() &&
+      (instances.empty() ||
+       std::memcmp(staged.data(), instances.data(), instances.size_bytes()) == 0))
+  {
+    m_drawnStaging = m_sharedStaging.get();
+    return;
+  }
+  m_ownStaging.Update(ctx, instances);
+  m_drawnStaging = &m_ownStaging;
+}
+
+template<InstanceTraits TraitsT>
+inline void InstancedRenderer<TraitsT>::SetInstances(std::span<const Instance> instances,
+                                                      uint64_t version)
+{
+  if (m_sharedStaging->version != version)
+  {
+    PROFILE_ZONE("InstancedRenderer::SetInstances");
+    m_sharedStaging->Update(GetDevice().GetContext(), instances);
+    m_sharedStaging->version = version;
+  }
+  m_drawnStaging = m_sharedStaging.get();
+}
+
+template<InstanceTraits TraitsT>
+inline void InstancedRenderer<TraitsT>::Submit()
+{
+  PROFILE_ZONE("InstancedRenderer::Submit");
+  if (m_shadersGeneration != GetShaderCache().GetGeneration())
+    AttachShaders();
+
+  const Staging & staging = *m_drawnStaging;
+  if (m_renderPass && m_renderPass->ShouldBeInvalidated() && !staging.batch.Empty())
+  {
+    auto extent = GetDevice().GetFramebuffer().GetExtent();
+    m_renderPass->BeginPass();
+    m_renderPass->SetScissor(0, 0, extent[0], extent[1]);
+    m_renderPass->SetViewport(static_cast<float>(extent[0]), static_cast<float>(extent[1]));
+    m_renderPass->BindVertexBuffer(0, *staging.buffer);
+    m_renderPass->DrawVertices(TraitsT::VerticesPerInstance, staging.batch.Size());
+    m_renderPass->EndPass();
+  }
+}
+template<InstanceTraits TraitsT>
+inline void InstancedRenderer<TraitsT>::AttachShaders()
+{
+  auto && cache = GetShaderCache();
+  m_shadersGeneration = cache.GetGeneration();
+  auto && subpassConfig = m_renderPass->GetConfiguration();
+  m_vertexShader = cache.Load(TraitsT::VertexShader);
+  m_fragmentShader = cache.Load(TraitsT::FragmentShader);
+  subpassConfig.AttachShader(RHI::ShaderType::Vertex, m_vertexShader->GetSpirV());
+  subpassConfig.AttachShader(RHI::ShaderType::Fragment, m_fragmentShader->GetSpirV());
+}
+
+} // namespace RenderPlugin
@@ -0,0 +1,78 @@
+#pragma once
+#include <limits>
+#include <map>
+#include <memory>
+#include <span>
+#include <utility>
+
+#include <Render/InstanceBatch.hpp>
+#include <RHI.hpp>
+
+namespace RenderPlugin
+{
+
+/// @brief scenes whose instances are staged once for all devices of the plugin
+enum class SharedScene : uint8_t
+{
+  Immediate2D, ///< staged by the first device of the frame, others compare their instances
+  Immediate3D, ///< the same as Immediate2D
+  Retained3D,  ///< staged when version of the retained scene is changed
+};
+
+/// @brief instances of one scene and GPU buffer with them
+template<typename InstanceT>
+struct InstanceStaging final
+{
+  static constexpr uint64_t NoVersion = std::numeric_limits<uint64_t>::max();
+
+  GameFramework::InstanceBatch<InstanceT> batch;
+  RHI::IBufferGPU * buffer = nullptr;
+  size_t bufferCapacity = 0;
+  uint64_t version = NoVersion; ///< frame or scene version which instances belong to
+
+  /// @brief replace instances and upload the changed ones
+  void Update(RHI::IContext & ctx, std::span<const InstanceT> instances)
+  {
+    batch.Assign(instances);
+    batch.Commit();
+    if (!batch.IsDirty())
+      return;
+
+    size_t uploadCount = batch.GetDirtyRange().last;
+    if (batch.GetCapacity() != bufferCapacity || !buffer)
+    {
+      bufferCapacity = batch.GetCapacity();
+      buffer = ctx.AllocBuffer(bufferCapacity * sizeof(InstanceT),
+                               RHI::BufferGPUUsage::VertexBuffer, false);
+      uploadCount = batch.Size();
+    }
+    // buffer is written from the beginning, so instances after the last changed one are kept
+    buffer->UploadAsync(batch.GetInstances().data(), uploadCount * sizeof(InstanceT));
+    batch.MarkUploaded();
+  }
+};
+
+/*
+* Staging of shared scenes keyed by scene and instance layout.
+* Buffers are allocated in the context of the plugin, and devices own the staging together,
+* so it stays valid when the device which uploaded it is destroyed
+*/
+class SharedUploads final
+{
+public:
+  /// @brief get staging of the scene, it's created on the first request
+  /// @param layout - tag of instance layout, scenes of different layouts are never shared
+  template<typename InstanceT>
+  std::shared_ptr<InstanceStaging<InstanceT>> GetStaging(const void * layout, SharedScene scene)
+  {
+    auto && entry = m_stagings[{layout, scene}];
+    if (!entry)
+      entry = std::make_shared<InstanceStaging<InstanceT>>();
+    return std::static_pointer_cast<InstanceStaging<InstanceT>>(entry);
+  }
+
+private:
+  std::map<std::pair<const void *, SharedScene>, std::shared_ptr<void>> m_stagings;
+};
+
+} // namespace RenderPlugin
@@ -5,21 +5,36 @@
 
 namespace RenderPlugin
 {
-ScreenDevice::ScreenDevice(RHI::IContext & ctx, GameFramework::IWindow & window)
+static RHI::RenderBuffering ToBuffering(GameFramework::PresentMode presentMode) noexcept
+{
+  switch (presentMode)
+  {
+    case GameFramework::PresentMode::DoubleBuffering:
+      return RHI::RenderBuffering::Double;
+    case GameFramework::PresentMode::TripleBuffering:
+      return RHI::RenderBuffering::Triple;
+  }
+  return RHI::RenderBuffering::Triple;
+}
+
+ScreenDevice::ScreenDevice(RHI::IContext & ctx, GameFramework::IWindow & window,
+                           SharedSceneData & sharedData, GameFramework::PresentMode presentMode)
   : InternalDevice(ctx)
   , m_window(window)
+  , m_sharedData(sharedData)
   , m_framebuffer(ctx.CreateFramebuffer())
   , m_scene2D(*this)
   , m_scene3D(*this)
 {
   auto [hwnd, hInstance] = window.GetSurface();
   RHI::SurfaceConfig config{hwnd, hInstance};
-  m_msaaResolveAttachment = ctx.CreateSurfacedAttachment(config, RHI::RenderBuffering::Triple);
+  const RHI::RenderBuffering buffering = ToBuffering(presentMode);
+  m_msaaResolveAttachment = ctx.CreateSurfacedAttachment(config, buffering);
   auto description = m_msaaResolveAttachment->GetDescription();
-  m_colorAttachment = ctx.AllocAttachment(description.format, description.extent,
-                                          RHI::RenderBuffering::Triple, RHI::SamplesCount::Eight);
+  m_colorAttachment = ctx.AllocAttachment(description.format, description.extent, buffering,
+                                          RHI::SamplesCount::Eight);
   m_depthStencilAttachment = ctx.AllocAttachment(RHI::ImageFormat::DEPTH_STENCIL,
-                                                 description.extent, RHI::RenderBuffering::Triple,
+                                                 description.extent, buffering,
                                                  RHI::SamplesCount::Eight);
 
   m_framebuffer->AddAttachment(0, m_colorAttachment);
@@ -43,6 +58,11 @@ GameFramework::Scene3DUPtr ScreenDevice::AcquireScene3D()
   return std::make_unique<Scene3D_CPU>(m_scene3D);
 }
 
+GameFramework::IRetainedScene3D & ScreenDevice::GetRetainedScene3D() & noexcept
+{
+  return m_sharedData.GetRetainedScene();
+}
+
 int ScreenDevice::GetOwnerId() const noexcept
 {
   return GetWindow().GetId();
@@ -66,6 +86,14 @@ bool ScreenDevice::BeginFrame()
 
 void ScreenDevice::EndFrame()
 {
+  m_scene3D.FlushRetained();
+
+  m_recordTasks.clear();
+  m_scene2D.CollectRecordTasks(m_recordTasks);
+  m_scene3D.CollectRecordTasks(m_recordTasks);
+  // subpasses are merged in order of their creation, so order of recording doesn't matter
+  GameFramework::GetThreadPool().ParallelFor(m_recordTasks.size(),
+                                             [this](size_t i) { m_recordTasks[i](); });
   m_framebuffer->EndFrame();
   m_renderTarget = nullptr;
 }
@@ -6,6 +6,7 @@
 #include <Render2D/Scene2D_GPU.hpp>
 #include <Render3D/Scene3D_GPU.hpp>
 #include <RHI.hpp>
+#include <SharedSceneData.hpp>
 
 namespace RenderPlugin
 {
@@ -13,12 +14,14 @@ namespace RenderPlugin
 struct ScreenDevice : public GameFramework::IScreenDevice,
                       public InternalDevice
 {
-  explicit ScreenDevice(RHI::IContext & ctx, GameFramework::IWindow & window);
+  explicit ScreenDevice(RHI::IContext & ctx, GameFramework::IWindow & window,
+                        SharedSceneData & sharedData, GameFramework::PresentMode presentMode);
   virtual ~ScreenDevice() override;
 
 public: // IDevice interface
   virtual GameFramework::Scene2DUPtr AcquireScene2D() override;
   virtual GameFramework::Scene3DUPtr AcquireScene3D() override;
+  virtual GameFramework::IRetainedScene3D & GetRetainedScene3D() & noexcept override;
   virtual int GetOwnerId() const noexcept override;
   virtual float GetAspectRatio() const noexcept override;
 
@@ -32,9 +35,11 @@ public: //IScreenDevice interface
 public: // internal device
   virtual void ConfigurePipeline(RHI::ISubpassConfiguration & config) const override;
   virtual RHI::IFramebuffer& GetFramebuffer() & noexcept override;
+  virtual SharedSceneData & GetSharedData() & noexcept override { return m_sharedData; }
 
 private:
   GameFramework::IWindow & m_window;
+  SharedSceneData & m_sharedData;
   RHI::IFramebuffer * m_framebuffer = nullptr;
   RHI::IRenderTarget * m_renderTarget = nullptr;
   RHI::IAttachment * m_colorAttachment = nullptr;
@@ -43,6 +48,7 @@ private:
 
   Scene2D_GPU m_scene2D;
   Scene3D_GPU m_scene3D;
+  RecordTasks m_recordTasks;
 };
 
 } // namespace RenderPlugin
@@ -0,0 +1,87 @@
+#include "ShaderCache.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <Constants.hpp>
+#include <GameFramework.hpp>
+#include <Utility/Hash.hpp>
+
+namespace RenderPlugin
+{
+
+ShaderModulePtr ShaderCache::Load(const std::filesystem::path & fileName)
+{
+  std::lock_guard lk{m_mutex};
+  const std::string key = fileName.generic_string();
+  if (auto it = m_files.find(key); it != m_files.end())
+  {
+    m_stats.hits++;
+    return it->second;
+  }
+
+  m_stats.misses++;
+  auto && stream = GameFramework::GetFileManager().OpenRead(g_shadersDirectory / fileName);
+  auto file = std::make_shared<ShaderFile>();
+  stream->ReadValue<ShaderFile>(*file);
+
+  auto && spirv = file->GetSpirV();
+  const uint64_t hash = GameFramework::Utils::HashSpan(std::span<const uint32_t>(spirv));
+  auto [first, last] = m_modules.equal_range(hash);
+  auto sameModule = std::find_if(first, last, [&spirv](auto && entry)
+                                 { return entry.second->GetSpirV() == spirv; });
+  ShaderModulePtr result =
+    sameModule != last ? sameModule->second : m_modules.emplace(hash, std::move(file))->second;
+  m_stats.modules = m_modules.size();
+  m_files.emplace(key, result);
+  return result;
+}
+
+void ShaderCache::Invalidate(const std::filesystem::path & fileName)
+{
+  std::lock_guard lk{m_mutex};
+  m_files.erase(fileName.generic_string());
+  m_hasStaleModules = true;
+  m_generation++;
+}
+
+void ShaderCache::ReleaseUnused()
+{
+  std::lock_guard lk{m_mutex};
+  if (!m_hasStaleModules)
+    return;
+
+  std::unordered_set<const ShaderFile *> filesModules;
+  for (auto && [name, module] : m_files)
+    filesModules.insert(module.get());
+
+  // module of no file is erased when the last pipeline using it is recreated
+  m_hasStaleModules = false;
+  for (auto it = m_modules.begin(); it != m_modules.end();)
+  {
+    if (filesModules.contains(it->second.get()))
+      ++it;
+    else if (it->second.use_count() > 1)
+    {
+      m_hasStaleModules = true;
+      ++it;
+    }
+    else
+      it = m_modules.erase(it);
+  }
+  m_stats.modules = m_modules.size();
+}
+
+ShaderCache::Stats ShaderCache::GetStats() const
+{
+  std::lock_guard lk{m_mutex};
+  return m_stats;
+}
+
+ShaderCache & GetShaderCache()
+{
+  static ShaderCache s_cache;
+  return s_cache;
+}
+
+} // namespace RenderPlugin
@@ -0,0 +1,51 @@
+#pragma once
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <ShaderFile.hpp>
+
+namespace RenderPlugin
+{
+using ShaderModulePtr = std::shared_ptr<const ShaderFile>;
+
+/// @brief compiled shaders of the process. Each file is read once for all devices,
+///        equal SPIR-V of different files is stored once (modules are keyed by content hash).
+///        Pipelines keep pointers of their modules, so old module lives until it's replaced
+class ShaderCache final
+{
+public:
+  struct Stats
+  {
+    size_t hits = 0;    ///< loads without reading of file
+    size_t misses = 0;  ///< loads with reading of file
+    size_t modules = 0; ///< count of unique modules
+  };
+
+public:
+  /// @brief get compiled shader from g_shadersDirectory
+  ShaderModulePtr Load(const std::filesystem::path & fileName);
+  /// @brief forget the file, next Load will read it again
+  void Invalidate(const std::filesystem::path & fileName);
+  /// @brief erase modules which are used neither by files nor by pipelines (old versions of
+  ///        reloaded shaders). It's called once per frame and does nothing until Invalidate
+  void ReleaseUnused();
+  /// @brief counter of invalidations. Users of shaders reload them when it's changed
+  uint64_t GetGeneration() const noexcept { return m_generation; }
+  Stats GetStats() const;
+
+private:
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, ShaderModulePtr> m_files;
+  std::unordered_multimap<uint64_t, ShaderModulePtr> m_modules;
+  Stats m_stats;
+  bool m_hasStaleModules = false;
+  std::atomic<uint64_t> m_generation = 0;
+};
+
+ShaderCache & GetShaderCache();
+
+} // namespace RenderPlugin
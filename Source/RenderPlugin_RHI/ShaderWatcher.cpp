@@ -0,0 +1,109 @@
+#include "ShaderWatcher.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+
+#include <GameFramework.hpp>
+#include <ShaderCache.hpp>
+
+namespace RenderPlugin
+{
+static constexpr std::chrono::milliseconds s_scanPeriod(500);
+
+namespace
+{
+/// @brief name of compiled shader (the same as CompileSpirV.cmake produces)
+std::filesystem::path GetCompiledName(const std::filesystem::path & source)
+{
+  auto stage = source.extension().string(); // .vert, .frag, .geom
+  return source.stem().string() + "_" + stage.substr(1) + ".spv";
+}
+
+bool IsShaderSource(const std::filesystem::path & path)
+{
+  auto ext = path.extension();
+  return ext == ".vert" || ext == ".frag" || ext == ".geom";
+}
+} // namespace
+
+ShaderWatcher::ShaderWatcher(std::vector<std::filesystem::path> sourcesDirectories,
+                             std::filesystem::path outputDirectory)
+  : m_sourcesDirectories(std::move(sourcesDirectories))
+  , m_outputDirectory(std::move(outputDirectory))
+{
+  Scan(false);
+  m_thread = std::jthread(
+    [this](std::stop_token stop)
+    {
+      std::mutex mutex;
+      std::condition_variable_any wakeUp;
+      std::unique_lock lk{mutex};
+      while (!stop.stop_requested())
+      {
+        wakeUp.wait_for(lk, stop, s_scanPeriod, [] { return false; });
+        if (!stop.stop_requested())
+          Scan(true);
+      }
+    });
+  for (auto && directory : m_sourcesDirectories)
+    GameFramework::Log(GameFramework::LogMessageType::Info, "Shaders hot reload is enabled for ",
+                       directory.string());
+}
+
+ShaderWatcher::~ShaderWatcher() = default;
+
+void ShaderWatcher::Scan(bool compileChanged)
+{
+  std::error_code ec;
+  for (auto && directory : m_sourcesDirectories)
+  {
+    for (auto && entry : std::filesystem::recursive_directory_iterator(directory, ec))
+    {
+      if (!entry.is_regular_file(ec) || !IsShaderSource(entry.path()))
+        continue;
+      const auto writeTime = entry.last_write_time(ec);
+      if (ec)
+        continue;
+      auto [it, inserted] = m_timestamps.try_emplace(entry.path().string(), writeTime);
+      if (!inserted && it->second != writeTime)
+      {
+        it->second = writeTime;
+        if (compileChanged)
+          Compile(entry.path());
+      }
+    }
+  }
+}
+
+void ShaderWatcher::Compile(const std::filesystem::path & source)
+{
+  const auto compiledName = GetCompiledName(source);
+  const auto resultPath = m_outputDirectory / compiledName;
+  auto tmpPath = resultPath;
+  tmpPath += ".tmp";
+
+  const std::string command = "glslc \"" + source.string() + "\" -o \"" + tmpPath.string() + "\"";
+  if (std::system(command.c_str()) != 0)
+  {
+    GameFramework::Log(GameFramework::LogMessageType::Error, "Failed to compile shader ",
+                       source.string());
+    return;
+  }
+
+  // rename replaces the file at once, so nobody reads half-written shader
+  std::error_code ec;
+  std::filesystem::rename(tmpPath, resultPath, ec);
+  if (ec)
+  {
+    GameFramework::Log(GameFramework::LogMessageType::Error, "Failed to replace shader ",
+                       resultPath.string(), ": ", ec.message());
+    return;
+  }
+  GetShaderCache().Invalidate(compiledName);
+  GameFramework::Log(GameFramework::LogMessageType::Info, "Shader reloaded - ",
+                     compiledName.string());
+}
+
+} // namespace RenderPlugin
@@ -0,0 +1,33 @@
+#pragma once
+#include <filesystem>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace RenderPlugin
+{
+
+/// @brief dev-mode feature. Watches GLSL sources and recompiles changed ones in background thread.
+///        Compiled shader replaces old one in shaders directory and it's invalidated in ShaderCache,
+///        so renderers pick it up on the next frame
+class ShaderWatcher final
+{
+public:
+  /// @param sourcesDirectories - directories with GLSL sources (searched recursively)
+  /// @param outputDirectory - directory of compiled shaders (real path of g_shadersDirectory)
+  ShaderWatcher(std::vector<std::filesystem::path> sourcesDirectories,
+                std::filesystem::path outputDirectory);
+  ~ShaderWatcher();
+
+private:
+  std::vector<std::filesystem::path> m_sourcesDirectories;
+  std::filesystem::path m_outputDirectory;
+  std::unordered_map<std::string, std::filesystem::file_time_type> m_timestamps;
+  std::jthread m_thread;
+
+private:
+  void Scan(bool compileChanged);
+  void Compile(const std::filesystem::path & source);
+};
+
+} // namespace RenderPlugin
@@ -0,0 +1,25 @@
+#pragma once
+#include <Render3D/RetainedScene3D.hpp>
+#include <Renderer/SharedUploads.hpp>
+
+namespace RenderPlugin
+{
+
+/// @brief scene data of the render plugin which is shared by all devices.
+///        Devices keep only their camera, viewport and subpasses
+class SharedSceneData final
+{
+public:
+  RetainedScene3D & GetRetainedScene() & noexcept { return m_retainedScene; }
+  SharedUploads & GetUploads() & noexcept { return m_uploads; }
+  /// @brief number of current frame, immediate scenes are staged once per frame
+  uint64_t GetFrame() const noexcept { return m_frame; }
+  void NextFrame() noexcept { m_frame++; }
+
+private:
+  RetainedScene3D m_retainedScene;
+  SharedUploads m_uploads;
+  uint64_t m_frame = 0;
+};
+
+} // namespace RenderPlugin
@@ -1,21 +1,29 @@
 #include <Constants.hpp>
 #include <GameFramework.hpp>
 #include <ScreenDevice.hpp>
+#include <ShaderCache.hpp>
+#include <ShaderWatcher.hpp>
 
 namespace RenderPlugin
 {
 struct RenderPlugin_RHI : public GameFramework::RenderPlugin
 {
   explicit RenderPlugin_RHI(const GameFramework::IPluginLoader & loader);
-  virtual ~RenderPlugin_RHI() = default;
+  virtual ~RenderPlugin_RHI() override;
 
   virtual GameFramework::ScreenDeviceUPtr CreateScreenDevice(
-    GameFramework::IWindow & window) override;
+    GameFramework::IWindow & window, GameFramework::PresentMode presentMode) override;
+  virtual GameFramework::IRetainedScene3D & GetRetainedScene3D() & noexcept override
+  {
+    return m_sharedData.GetRetainedScene();
+  }
 
   virtual void Tick() override;
 
 private:
   std::unique_ptr<RHI::IContext> m_context;
+  SharedSceneData m_sharedData;
+  std::unique_ptr<ShaderWatcher> m_shaderWatcher; ///< only when SHADERS_HOT_RELOAD is on
 };
 
 RenderPlugin_RHI::RenderPlugin_RHI(const GameFramework::IPluginLoader & loader)
@@ -26,16 +34,31 @@ RenderPlugin_RHI::RenderPlugin_RHI(const GameFramework::IPluginLoader & loader)
   RHI::GpuTraits gpuTraits{};
   gpuTraits.require_presentation = true;
   m_context = CreateContext(gpuTraits, nullptr);
+#ifdef SHADERS_SOURCE_DIRECTORY
+  const std::filesystem::path sourcesDirectory(SHADERS_SOURCE_DIRECTORY);
+  m_shaderWatcher = std::make_unique<ShaderWatcher>(
+    std::vector{sourcesDirectory / "Render2D/Shaders", sourcesDirectory / "Render3D/Shaders"},
+    loader.Path() / g_shadersDirectory);
+#endif
+}
+
+RenderPlugin_RHI::~RenderPlugin_RHI()
+{
+  auto stats = GetShaderCache().GetStats();
+  GameFramework::Log(GameFramework::LogMessageType::Info, "Shader cache: ", stats.hits, " hits, ",
+                     stats.misses, " misses, ", stats.modules, " modules");
 }
 
 GameFramework::ScreenDeviceUPtr RenderPlugin_RHI::CreateScreenDevice(
-  GameFramework::IWindow & window)
+  GameFramework::IWindow & window, GameFramework::PresentMode presentMode)
 {
-  return std::make_unique<ScreenDevice>(*m_context, window);
+  return std::make_unique<ScreenDevice>(*m_context, window, m_sharedData, presentMode);
 }
 
 void RenderPlugin_RHI::Tick()
 {
+  m_sharedData.NextFrame();
+  GetShaderCache().ReleaseUnused();
   m_context->ClearResources();
   m_context->TransferPass();
 }